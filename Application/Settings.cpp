@@ -26,6 +26,7 @@
 
 #include <QVariant>
 #include <QDir>
+#include <QFile>
 #include <QSettings>
 #include <QtGlobal>
 #include <QApplication>
@@ -40,6 +41,8 @@
 
 #include <Utility/helpfunctions.h>
 
+#include "Constants.h"
+
 namespace App
 {
 
@@ -68,7 +71,12 @@ namespace App
 
         const QString dbGroup = "DB";
         const Setting<QString> dbName {"global-db-name", wrappDefault("global")};
-        const Setting<QString> dbPath {"global-db-path", wrappDefault(QDir::currentPath())};
+        const Setting<QString> dbPath {"global-db-path", [] {
+            // Prefer the snapshot generated during the build
+            const QString appDir = QApplication::applicationDirPath();
+            return QFile::exists(appDir + QDir::separator() + "global." + DEFAULT_DATABASE_EXTENSION)
+                   ? appDir : QDir::currentPath();
+        }};
 
         const QString elGroup = "Elements";
         const QVector<Setting<QColor>> elColors =
@@ -92,6 +100,11 @@ namespace App
                                               [] { return QApplication::applicationDirPath(); }};
         const Setting<QString> newProjectDir{"last-new-project-dir",
                                               [] { return QApplication::applicationDirPath(); }};
+        const Setting<int> autosave{"autosave-interval-sec", wrappDefault(10)};
+
+        const QString undoGroup{"Undo"};
+        const Setting<int> undoCount{"undo-limit", wrappDefault(0)};
+        const Setting<int> undoMemory{"undo-memory-limit-mb", wrappDefault(0)};
 
         // Helpers
         template <class ValueType>
@@ -274,6 +287,61 @@ namespace App
             write(projGroup, newProjectDir.name, path);
         }
 
+        /**
+         * @brief undoLimit
+         * @return maximum number of undo steps, 0 means unlimited
+         */
+        int undoLimit()
+        {
+            return read(undoGroup, undoCount.name, undoCount.defaultValue());
+        }
+
+        /**
+         * @brief setUndoLimit
+         * @param count
+         */
+        void setUndoLimit(int count)
+        {
+            write(undoGroup, undoCount.name, count);
+        }
+
+        /**
+         * @brief undoMemoryLimit
+         * @return maximum memory used by undo history in megabytes, 0 means unlimited
+         */
+        int undoMemoryLimit()
+        {
+            return read(undoGroup, undoMemory.name, undoMemory.defaultValue());
+        }
+
+        /**
+         * @brief setUndoMemoryLimit
+         * @param megabytes
+         */
+        void setUndoMemoryLimit(int megabytes)
+        {
+            write(undoGroup, undoMemory.name, megabytes);
+        }
+
+        /**
+         * @brief autosaveInterval
+         * @return interval between writing changes to the project journal in seconds, 0 means
+         *         autosave is disabled
+         */
+        int autosaveInterval()
+        {
+            return read(projGroup, autosave.name, autosave.defaultValue());
+        }
+
+        /**
+         * @brief setAutosaveInterval
+         * @param seconds
+         */
+        void setAutosaveInterval(int seconds)
+        {
+            write(projGroup, autosave.name, seconds);
+        }
+
     } // namespace settings
 
 } // namespace application
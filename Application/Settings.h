@@ -62,6 +62,17 @@ namespace App {
         // Last new peoject directory
         QString lastNewProjectDir();
         void setLastNewProjectDir(const QString &path);
+
+        // Undo history limits
+        int undoLimit();
+        void setUndoLimit(int count);
+
+        int undoMemoryLimit();
+        void setUndoMemoryLimit(int megabytes);
+
+        // Project autosave
+        int autosaveInterval();
+        void setAutosaveInterval(int seconds);
     }
 
 } // namespace application
@@ -87,6 +87,15 @@ namespace Commands {
         return true;
     }
 
+    /**
+     * @brief BaseCommand::footprint
+     * @return
+     */
+    qint64 BaseCommand::footprint() const
+    {
+        return qint64(sizeof(*this)) + text().size() * qint64(sizeof(QChar));
+    }
+
     /**
      * @brief BaseCommand::undoImpl
      */
@@ -47,6 +47,9 @@ namespace Commands {
         /// Actual redo implementation. Doesn't track project state
         virtual void redoImpl();
 
+        /// Approximate size of memory used by the command to store undo/redo data, in bytes
+        virtual qint64 footprint() const;
+
     public: // QUndoCommand overrides
         void undo() override;
         void redo() override;
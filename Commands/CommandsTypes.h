@@ -36,5 +36,12 @@ namespace Commands {
 
     using SharedCommandStack = std::shared_ptr<QUndoStack>;
 
+    /// Identifiers of commands which can be merged, see QUndoCommand::id()
+    enum class CommandID : int
+    {
+        MoveGraphicObject = 1,   ///< MoveGraphicObject
+        ResizeGraphicEntity = 2, ///< ResizeGraphicEntity
+    };
+
 } // namespace Commands
 
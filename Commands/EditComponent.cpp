@@ -0,0 +1,67 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "EditComponent.h"
+
+#include <Common/BasicElement.h>
+#include <Models/ComponentsModel.h>
+
+#include "QtHelpers.h"
+
+namespace Commands {
+
+    /**
+     * @brief EditComponent::EditComponent
+     * @param model
+     * @param index
+     * @param newComponent
+     * @param keeper
+     * @param parent
+     */
+    EditComponent::EditComponent(const Models::SharedClassComponentsModel &model,
+                                 const QModelIndex &index,
+                                 const Common::SharedBasicEntity &newComponent,
+                                 MementoStateKeeper *keeper, QUndoCommand *parent)
+        : Memento(G_ASSERT(model)->element(index), keeper, tr("Edit component"), parent)
+        , m_Model(model)
+        , m_Index(index)
+        , m_NewComponent(newComponent)
+    {
+    }
+
+    /**
+     * @brief EditComponent::redoImpl
+     */
+    void EditComponent::redoImpl()
+    {
+        // The model updates the component, only deltas are used after that
+        if (!m_Done && G_ASSERT(m_Index.isValid() && m_NewComponent)) {
+            m_Model->setData(m_Index, QVariant::fromValue(m_NewComponent),
+                             Models::ComponentsModel::UpdateSignature);
+            m_Index = QPersistentModelIndex();
+            m_NewComponent.reset();
+        }
+
+        Memento::redoImpl();
+    }
+
+} // namespace Commands
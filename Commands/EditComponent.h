@@ -0,0 +1,52 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QPersistentModelIndex>
+
+#include <Common/CommonTypes.hpp>
+#include <Models/ModelsTypes.hpp>
+
+#include "MementoCmd.hpp"
+
+namespace Commands {
+
+    /// Changes a component in place, e.g. after its signature is edited. Undo and redo
+    /// are done with deltas of the component state
+    class EditComponent : public Memento
+    {
+    public:
+        EditComponent(const Models::SharedClassComponentsModel &model, const QModelIndex &index,
+                      const Common::SharedBasicEntity &newComponent,
+                      MementoStateKeeper *keeper = nullptr, QUndoCommand *parent = nullptr);
+
+    public: // BaseCommand overridies
+        void redoImpl() override;
+
+    private:
+        Models::SharedClassComponentsModel m_Model;
+        QPersistentModelIndex m_Index;               // Only until the first redo
+        Common::SharedBasicEntity m_NewComponent;    // Only until the first redo
+    };
+
+} // namespace Commands
@@ -0,0 +1,129 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "ImportDeclarations.h"
+
+#include <Entity/Class.h>
+#include <Entity/Components/declarationsimporter.h>
+#include <Entity/Scope.h>
+
+#include <Models/ProjectTreeModel.h>
+
+#include "QtHelpers.h"
+
+namespace Commands {
+
+    /**
+     * @brief ImportDeclarations::ImportDeclarations
+     * @param importer
+     * @param scope
+     * @param treeModel
+     * @param projectName
+     * @param parent
+     */
+    ImportDeclarations::ImportDeclarations(const Components::DeclarationsImporter &importer,
+                                           Entity::SharedScope scope,
+                                           Models::SharedTreeModel treeModel,
+                                           const QString &projectName, QUndoCommand *parent)
+        : BaseCommand(tr("Import declarations"), parent)
+        , m_Scope(std::move(G_ASSERT(scope)))
+        , m_TreeModel(std::move(treeModel))
+        , m_ProjectName(projectName)
+        , m_Types(importer.types())
+        , m_Target(importer.targetClass())
+        , m_Methods(importer.targetMethods())
+        , m_Fields(importer.targetFields())
+    {
+    }
+
+    /**
+     * @brief ImportDeclarations::redoImpl
+     */
+    void ImportDeclarations::redoImpl()
+    {
+        sanityCheck();
+
+        {
+            // The tree model is reset once instead of inserting rows for each type
+            qthelpers::BulkLoadGuard<Models::ProjectTreeModel> bulkLoad(
+                m_Types.count() > 1 ? m_TreeModel.get() : nullptr);
+
+            for (auto &&type : m_Types) {
+                m_Scope->addExistsType(type);
+                if (m_TreeModel)
+                    m_TreeModel->addType(type, m_Scope->id(), m_ProjectName);
+            }
+        }
+
+        for (auto &&method : m_Methods)
+            m_Target->addExistsMethod(method);
+
+        for (auto &&field : m_Fields)
+            m_Target->addExistsField(field);
+
+        m_Done = true;
+    }
+
+    /**
+     * @brief ImportDeclarations::undoImpl
+     */
+    void ImportDeclarations::undoImpl()
+    {
+        sanityCheck();
+
+        for (auto it = m_Fields.rbegin(); it != m_Fields.rend(); ++it)
+            m_Target->removeField(*it);
+
+        for (auto it = m_Methods.rbegin(); it != m_Methods.rend(); ++it)
+            m_Target->removeMethod(*it);
+
+        qthelpers::BulkLoadGuard<Models::ProjectTreeModel> bulkLoad(
+            m_Types.count() > 1 ? m_TreeModel.get() : nullptr);
+
+        for (auto it = m_Types.rbegin(); it != m_Types.rend(); ++it) {
+            const Common::ID id = (*it)->id();
+            if (m_TreeModel)
+                m_TreeModel->removeType(m_ProjectName, m_Scope->id(), id);
+            m_Scope->removeType(id);
+        }
+    }
+
+    /**
+     * @brief ImportDeclarations::types
+     * @return
+     */
+    Entity::TypesList ImportDeclarations::types() const
+    {
+        return m_Types;
+    }
+
+    /**
+     * @brief ImportDeclarations::sanityCheck
+     */
+    void ImportDeclarations::sanityCheck()
+    {
+        Q_ASSERT(m_Scope);
+        Q_ASSERT(m_Target || (m_Methods.isEmpty() && m_Fields.isEmpty()));
+        Q_ASSERT(!m_TreeModel || !m_ProjectName.isEmpty());
+    }
+
+} // namespace Commands
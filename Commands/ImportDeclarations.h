@@ -0,0 +1,62 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <Entity/EntityTypes.hpp>
+#include <Models/ModelsTypes.hpp>
+
+#include "BaseCommand.h"
+
+namespace Components { class DeclarationsImporter; }
+
+namespace Commands {
+
+    /// Adds everything imported from C++ declarations as a single undoable step
+    class ImportDeclarations : public BaseCommand
+    {
+    public:
+        ImportDeclarations(const Components::DeclarationsImporter &importer,
+                           Entity::SharedScope scope, Models::SharedTreeModel treeModel,
+                           const QString &projectName, QUndoCommand *parent = nullptr);
+
+        void redoImpl() override;
+        void undoImpl() override;
+
+        Entity::TypesList types() const;
+
+    protected: // BaseCommand overridies
+        void sanityCheck() override;
+
+    private:
+        Entity::SharedScope m_Scope;
+        Models::SharedTreeModel m_TreeModel;
+        QString m_ProjectName;
+
+        Entity::TypesList m_Types;
+
+        Entity::SharedClass m_Target;
+        Entity::MethodsList m_Methods;
+        Entity::FieldsList m_Fields;
+    };
+
+} // namespace Commands
@@ -31,6 +31,8 @@
 
 #include <Project/ProjectDB.hpp>
 
+#include <GUI/graphics/Scene.h>
+
 namespace Commands
 {
 
@@ -72,6 +74,8 @@ namespace Commands
     {
         sanityCheck();
 
+        qthelpers::BulkLoadGuard<Graphics::Scene> bulkLoad(qobject_cast<Graphics::Scene*>(m_Scene.data()));
+
         ranges::for_each(m_CurrentGraphicItems, [](auto &&i) { G_ASSERT(i->scene())->removeItem(i); });
         G_ASSERT(m_AppModel->setCurrentProject(m_PreviousProjectName));
         ranges::for_each(m_PreviousGraphicItems, [this](auto &&i) { G_ASSERT(m_Scene)->addItem(i); });
@@ -96,6 +100,8 @@ namespace Commands
 
         sanityCheck();
 
+        qthelpers::BulkLoadGuard<Graphics::Scene> bulkLoad(qobject_cast<Graphics::Scene*>(m_Scene.data()));
+
         ranges::for_each(m_PreviousGraphicItems, [](auto &&i) { G_ASSERT(i->scene())->removeItem(i); });
         G_ASSERT(m_AppModel->setCurrentProject(m_CurrentProjectName));
         ranges::for_each(m_CurrentGraphicItems, [this](auto &&i) { G_ASSERT(m_Scene)->addItem(i); });
@@ -22,18 +22,96 @@
 *****************************************************************************/
 #include "MementoCmd.hpp"
 
+#include <QUndoStack>
+
+#include <Common/BasicElement.h>
 #include <Common/IOriginator.hpp>
 #include <Common/Memento.hpp>
 
 namespace Commands {
 
+    /**
+     * @brief MementoStateKeeper::MementoStateKeeper
+     * @param stack
+     */
+    MementoStateKeeper::MementoStateKeeper(QUndoStack &stack)
+        : QObject(&stack)
+    {
+    }
+
+    /**
+     * @brief MementoStateKeeper::attach
+     * @param stack
+     * @return the keeper of the stack, it's created on the first call
+     */
+    MementoStateKeeper *MementoStateKeeper::attach(QUndoStack &stack)
+    {
+        if (auto keeper = stack.findChild<MementoStateKeeper *>(QString(),
+                                                                Qt::FindDirectChildrenOnly))
+            return keeper;
+
+        return new MementoStateKeeper(stack);
+    }
+
+    /**
+     * @brief MementoStateKeeper::state
+     * @param originator
+     * @return the actual state of the originator, if it's kept
+     */
+    std::optional<QJsonObject> MementoStateKeeper::state(
+        const Common::SharedOriginator &originator) const
+    {
+        if (!originator || m_Originator.lock() != originator)
+            return std::nullopt;
+
+        return m_State;
+    }
+
+    /**
+     * @brief MementoStateKeeper::keep
+     * @param originator
+     * @param state
+     */
+    void MementoStateKeeper::keep(const Common::SharedOriginator &originator,
+                                  const QJsonObject &state)
+    {
+        drop();
+
+        auto element = std::dynamic_pointer_cast<Common::BasicElement>(originator);
+        if (!element)
+            return;
+
+        m_Originator = originator;
+        m_State = state;
+        m_Connection = connect(element.get(), &Common::BasicElement::changed,
+                               this, &MementoStateKeeper::drop);
+    }
+
+    /**
+     * @brief MementoStateKeeper::drop
+     */
+    void MementoStateKeeper::drop()
+    {
+        disconnect(m_Connection);
+        m_Originator.reset();
+        m_State = QJsonObject();
+    }
+
     /**
      * @brief Memento::Memento
      * @param originator
+     * @param keeper state keeper of the stack, optional
+     * @param name
+     * @param parent
      */
-    Memento::Memento(Common::SharedOriginator originator)
-        : m_Originator(std::move(originator))
+    Memento::Memento(Common::SharedOriginator originator, MementoStateKeeper *keeper,
+                     const QString &name, QUndoCommand *parent)
+        : BaseCommand(name, parent)
+        , m_Originator(std::move(originator))
+        , m_Keeper(keeper)
     {
+        if (G_ASSERT(m_Originator))
+            m_PrevState = currentState();
     }
 
     /**
@@ -41,10 +119,7 @@ namespace Commands {
      */
     void Memento::undoImpl()
     {
-        if (G_ASSERT(m_PrevState && m_Originator))
-            if (auto errors = m_Originator->importState(*m_PrevState))
-                for (auto &&e: errors.value())
-                    qDebug() << e;
+        applyDelta(m_UndoDelta);
     }
 
     /**
@@ -52,10 +127,85 @@ namespace Commands {
      */
     void Memento::redoImpl()
     {
-        if (!m_Done) {
-            if (G_ASSERT(m_Originator))
-                m_PrevState = m_Originator->exportState();
+        if (m_Done) {
+            applyDelta(m_RedoDelta);
+            return;
         }
+
+        if (G_ASSERT(m_Originator)) {
+            const QJsonObject currState = m_Originator->exportState()->json();
+
+            m_RedoDelta = Common::MementoDelta::make(m_PrevState, currState);
+            m_UndoDelta = Common::MementoDelta::make(currState, m_PrevState);
+
+            // Full previous state is not required anymore
+            m_PrevState = QJsonObject();
+            keepState(currState);
+        }
+
+        m_Done = true;
+    }
+
+    /**
+     * @brief Memento::footprint
+     * @return
+     */
+    qint64 Memento::footprint() const
+    {
+        return BaseCommand::footprint() + m_UndoDelta.footprint() + m_RedoDelta.footprint();
+    }
+
+    /**
+     * @brief Memento::currentState
+     * @return kept state if it's actual, exported one otherwise
+     */
+    QJsonObject Memento::currentState() const
+    {
+        if (m_Keeper)
+            if (auto state = m_Keeper->state(m_Originator))
+                return *state;
+
+        return m_Originator->exportState()->json();
+    }
+
+    /**
+     * @brief Memento::applyDelta
+     * @param delta
+     */
+    void Memento::applyDelta(const Common::MementoDelta &delta)
+    {
+        if (!G_ASSERT(m_Originator) || delta.isEmpty())
+            return;
+
+        const QJsonObject current = currentState();
+
+        QStringList errors;
+        auto json = delta.apply(current, errors);
+        if (!errors.isEmpty()) {
+            for (auto &&e: errors)
+                qDebug() << e;
+            return;
+        }
+
+        // Originator is rolled back to the current state on errors
+        const Common::Memento currentMemento(current);
+        if (auto importErrors = m_Originator->importState(Common::Memento(json), &currentMemento)) {
+            for (auto &&e: importErrors.value())
+                qDebug() << e;
+            return;
+        }
+
+        keepState(json);
+    }
+
+    /**
+     * @brief Memento::keepState
+     * @param state
+     */
+    void Memento::keepState(const QJsonObject &state)
+    {
+        if (m_Keeper)
+            m_Keeper->keep(m_Originator, state);
     }
 
 } // namespace Commands
@@ -22,28 +22,75 @@
 *****************************************************************************/
 #pragma once
 
+#include <optional>
+
+#include <QJsonObject>
+#include <QPointer>
+
 #include <Common/CommonTypes.hpp>
+#include <Common/MementoDelta.hpp>
 
 #include "BaseCommand.h"
 
+QT_BEGIN_NAMESPACE
+class QUndoStack;
+QT_END_NAMESPACE
+
 namespace Commands {
 
+    /// Keeps the originator state made by the last applied Memento command of one stack, so
+    /// the history holds at most one full state. The state is dropped when the element is
+    /// changed by anything else. Only elements are tracked, as they emit changed() signal.
+    /// Owned by the stack
+    class MementoStateKeeper : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        static MementoStateKeeper *attach(QUndoStack &stack);
+
+        std::optional<QJsonObject> state(const Common::SharedOriginator &originator) const;
+        void keep(const Common::SharedOriginator &originator, const QJsonObject &state);
+        void drop();
+
+    private:
+        explicit MementoStateKeeper(QUndoStack &stack);
+
+        std::weak_ptr<Common::IOriginator> m_Originator;
+        QJsonObject m_State;
+        QMetaObject::Connection m_Connection;
+    };
+
+    /// Records a change of the originator state. Create the command before changing the
+    /// originator and push it after. Only the differences between states are kept.
+    /// With the state keeper of the stack the originator is exported once per change: the
+    /// state made by the previous command is used as the initial one, and undo right after
+    /// redo (and vice versa) doesn't export the originator at all
     class Memento : public BaseCommand
     {
     public: // Types
         using StateChanger = std::function<bool()>;
 
     public:
-        Memento(Common::SharedOriginator originator);
+        Memento(Common::SharedOriginator originator, MementoStateKeeper *keeper = nullptr,
+                const QString &name = tr("Change"), QUndoCommand *parent = nullptr);
 
     public: // BaseCommand overridies
         void undoImpl() override;
         void redoImpl() override;
 
+        qint64 footprint() const override;
+
     private:
+        QJsonObject currentState() const;
+        void applyDelta(const Common::MementoDelta &delta);
+        void keepState(const QJsonObject &state);
+
         Common::SharedOriginator m_Originator;
-        Common::UniqueMemento m_PrevState;
-        Common::UniqueMemento m_CurrState;
+        QPointer<MementoStateKeeper> m_Keeper;
+        QJsonObject m_PrevState; // Only until the first redo
+        Common::MementoDelta m_UndoDelta;
+        Common::MementoDelta m_RedoDelta;
     };
 
 } // namespace Commands
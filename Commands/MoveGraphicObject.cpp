@@ -22,7 +22,9 @@
 *****************************************************************************/
 #include "MoveGraphicObject.h"
 
-#include <QGraphicsItem>
+#include <GUI/graphics/Entity.h>
+
+#include "CommandsTypes.h"
 
 namespace Commands {
 
@@ -32,23 +34,41 @@ namespace Commands {
      * @param name
      * @param from
      * @param to
+     * @param gesture
      * @param parent
      */
-    MoveGraphicObject::MoveGraphicObject(QGraphicsItem &object, const QString &name, const QPointF &from,
-                                         const QPointF &to, QUndoCommand *parent)
-        : BaseCommand(tr("Move object \"%1\"").arg(name), parent)
-        , m_Object(object)
-        , m_From(from)
-        , m_To(to)
+    MoveGraphicObject::MoveGraphicObject(Graphics::GraphisEntity &object, const QString &name,
+                                         const QPointF &from, const QPointF &to, int gesture,
+                                         QUndoCommand *parent)
+        : MoveGraphicObject({{&object, from, to}}, name, gesture, parent)
     {
     }
 
+    /**
+     * @brief MoveGraphicObject::MoveGraphicObject
+     * @param moves
+     * @param name name of the object, used if there is only one
+     * @param gesture
+     * @param parent
+     */
+    MoveGraphicObject::MoveGraphicObject(const Moves &moves, const QString &name, int gesture,
+                                         QUndoCommand *parent)
+        : BaseCommand(moves.size() == 1 ? tr("Move object \"%1\"").arg(name)
+                                         : tr("Move %n objects", "", moves.size()), parent)
+        , m_Moves(moves)
+        , m_Gesture(gesture)
+    {
+        Q_ASSERT(!m_Moves.isEmpty());
+    }
+
     /**
      * @brief MoveGraphicObject::redo
      */
     void MoveGraphicObject::redoImpl()
     {
-        m_Object.setPos(m_To); // To avoid infinity recursion, because object is already moved
+        for (auto &&m : m_Moves)
+            if (m.object)
+                m.object->setPos(m.to); // To avoid infinity recursion, because object is already moved
     }
 
     /**
@@ -56,7 +76,48 @@ namespace Commands {
      */
     void MoveGraphicObject::undoImpl()
     {
-        m_Object.setPos(m_From);
+        for (auto &&m : m_Moves)
+            if (m.object)
+                m.object->setPos(m.from);
+    }
+
+    /**
+     * @brief MoveGraphicObject::id
+     * @return
+     */
+    int MoveGraphicObject::id() const
+    {
+        return int(CommandID::MoveGraphicObject);
+    }
+
+    /**
+     * @brief MoveGraphicObject::mergeWith
+     * @param other
+     * @return true if other command moves the same objects within the same gesture
+     */
+    bool MoveGraphicObject::mergeWith(const QUndoCommand *other)
+    {
+        auto cmd = static_cast<const MoveGraphicObject *>(other);
+        if (m_Gesture == 0 || cmd->m_Gesture != m_Gesture || cmd->m_Moves.size() != m_Moves.size())
+            return false;
+
+        for (int i = 0, c = m_Moves.size(); i < c; ++i)
+            if (cmd->m_Moves[i].object != m_Moves[i].object)
+                return false;
+
+        for (int i = 0, c = m_Moves.size(); i < c; ++i)
+            m_Moves[i].to = cmd->m_Moves[i].to;
+
+        return true;
+    }
+
+    /**
+     * @brief MoveGraphicObject::footprint
+     * @return
+     */
+    qint64 MoveGraphicObject::footprint() const
+    {
+        return BaseCommand::footprint() + m_Moves.size() * qint64(sizeof(Move));
     }
 
 } // namespace Commands
@@ -23,26 +23,45 @@
 #pragma once
 
 #include <QPointF>
-#include "BaseCommand.h"
+#include <QVector>
+
+#include <GUI/graphics/GraphicsTypes.h>
 
-class QGraphicsItem;
+#include "BaseCommand.h"
 
 namespace Commands {
 
-    /// The MoveGraphicObject class
+    /// The MoveGraphicObject class. Moves one or several objects at once. Commands of the same
+    /// gesture (from mouse press to release) which move the same objects are merged
     class MoveGraphicObject : public BaseCommand
     {
     public:
-        MoveGraphicObject(QGraphicsItem &object, const QString &name,
-                          const QPointF &from, const QPointF &to, QUndoCommand * parent = nullptr);
+        /// The Move struct
+        struct Move
+        {
+            Graphics::EntityPtr object;
+            QPointF from;
+            QPointF to;
+        };
+        using Moves = QVector<Move>;
+
+        MoveGraphicObject(Graphics::GraphisEntity &object, const QString &name,
+                          const QPointF &from, const QPointF &to, int gesture = 0,
+                          QUndoCommand * parent = nullptr);
+        MoveGraphicObject(const Moves &moves, const QString &name, int gesture = 0,
+                          QUndoCommand * parent = nullptr);
 
         void redoImpl() override;
         void undoImpl() override;
 
+        int id() const override;
+        bool mergeWith(const QUndoCommand *other) override;
+
+        qint64 footprint() const override;
+
     private:
-        QGraphicsItem &m_Object;
-        QPointF m_From;
-        QPointF m_To;
+        Moves m_Moves;
+        int m_Gesture; // 0 means the command is never merged
     };
 
 } // // namespace Commands
@@ -0,0 +1,91 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "ResizeGraphicEntity.h"
+
+#include <GUI/graphics/Entity.h>
+
+#include "CommandsTypes.h"
+
+namespace Commands {
+
+    /**
+     * @brief ResizeGraphicEntity::ResizeGraphicEntity
+     * @param entity
+     * @param name
+     * @param from
+     * @param to
+     * @param parent
+     */
+    ResizeGraphicEntity::ResizeGraphicEntity(Graphics::GraphisEntity &entity, const QString &name,
+                                             const QSizeF &from, const QSizeF &to,
+                                             QUndoCommand *parent)
+        : BaseCommand(tr("Resize object \"%1\"").arg(name), parent)
+        , m_Entity(&entity)
+        , m_From(from)
+        , m_To(to)
+    {
+    }
+
+    /**
+     * @brief ResizeGraphicEntity::redoImpl
+     */
+    void ResizeGraphicEntity::redoImpl()
+    {
+        if (m_Entity)
+            m_Entity->resize(m_To);
+    }
+
+    /**
+     * @brief ResizeGraphicEntity::undoImpl
+     */
+    void ResizeGraphicEntity::undoImpl()
+    {
+        if (m_Entity)
+            m_Entity->resize(m_From);
+    }
+
+    /**
+     * @brief ResizeGraphicEntity::id
+     * @return
+     */
+    int ResizeGraphicEntity::id() const
+    {
+        return int(CommandID::ResizeGraphicEntity);
+    }
+
+    /**
+     * @brief ResizeGraphicEntity::mergeWith
+     * @param other
+     * @return true if other command resizes the same entity
+     */
+    bool ResizeGraphicEntity::mergeWith(const QUndoCommand *other)
+    {
+        auto cmd = static_cast<const ResizeGraphicEntity *>(other);
+        if (cmd->m_Entity != m_Entity)
+            return false;
+
+        m_To = cmd->m_To;
+        return true;
+    }
+
+} // namespace Commands
@@ -0,0 +1,53 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QPointer>
+#include <QSizeF>
+
+#include <GUI/graphics/GraphicsTypes.h>
+
+#include "BaseCommand.h"
+
+namespace Commands {
+
+    /// The ResizeGraphicEntity class. Consecutive resizes of the same entity are merged
+    class ResizeGraphicEntity : public BaseCommand
+    {
+    public:
+        ResizeGraphicEntity(Graphics::GraphisEntity &entity, const QString &name,
+                            const QSizeF &from, const QSizeF &to, QUndoCommand * parent = nullptr);
+
+        void redoImpl() override;
+        void undoImpl() override;
+
+        int id() const override;
+        bool mergeWith(const QUndoCommand *other) override;
+
+    private:
+        Graphics::EntityPtr m_Entity;
+        QSizeF m_From;
+        QSizeF m_To;
+    };
+
+} // namespace Commands
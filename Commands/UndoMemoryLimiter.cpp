@@ -0,0 +1,164 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "UndoMemoryLimiter.h"
+
+#include <QUndoStack>
+
+#include "BaseCommand.h"
+#include "QtHelpers.h"
+
+namespace Commands {
+
+    /**
+     * @brief UndoMemoryLimiter::UndoMemoryLimiter
+     * @param stack
+     * @param memoryLimit limit in bytes, 0 means unlimited
+     * @param parent
+     */
+    UndoMemoryLimiter::UndoMemoryLimiter(QUndoStack &stack, qint64 memoryLimit, QObject *parent)
+        : QObject(parent)
+        , m_Stack(&stack)
+        , m_MemoryLimit(memoryLimit)
+        , m_MemoryUsage(0)
+    {
+        // Index is changed after each push (including merges), undo, redo and clear
+        G_CONNECT(&stack, &QUndoStack::indexChanged, this, &UndoMemoryLimiter::onIndexChanged);
+        onIndexChanged(stack.index());
+    }
+
+    /**
+     * @brief UndoMemoryLimiter::memoryLimit
+     * @return
+     */
+    qint64 UndoMemoryLimiter::memoryLimit() const
+    {
+        return m_MemoryLimit;
+    }
+
+    /**
+     * @brief UndoMemoryLimiter::setMemoryLimit
+     * @param memoryLimit
+     */
+    void UndoMemoryLimiter::setMemoryLimit(qint64 memoryLimit)
+    {
+        m_MemoryLimit = memoryLimit;
+        checkMemoryUsage();
+    }
+
+    /**
+     * @brief UndoMemoryLimiter::memoryUsage
+     * @return
+     */
+    qint64 UndoMemoryLimiter::memoryUsage() const
+    {
+        return m_MemoryUsage;
+    }
+
+    /**
+     * @brief UndoMemoryLimiter::footprint
+     * @param command
+     * @return approximate size of the command with all children
+     */
+    qint64 UndoMemoryLimiter::footprint(const QUndoCommand &command)
+    {
+        qint64 result = 0;
+        if (auto cmd = dynamic_cast<const BaseCommand *>(&command))
+            result += cmd->footprint();
+        else
+            result += qint64(sizeof(QUndoCommand)) + command.text().size() * qint64(sizeof(QChar));
+
+        for (int i = 0, c = command.childCount(); i < c; ++i)
+            result += footprint(*command.child(i));
+
+        return result;
+    }
+
+    /**
+     * @brief UndoMemoryLimiter::onIndexChanged
+     * @param index
+     */
+    void UndoMemoryLimiter::onIndexChanged(int index)
+    {
+        if (!m_Stack)
+            return;
+
+        const int count = m_Stack->count();
+
+        // The stack with the count limit drops the oldest commands by itself
+        const QUndoCommand *first = count > 0 ? m_Stack->command(0) : nullptr;
+        while (!m_Footprints.isEmpty() && m_Footprints.first().first != first)
+            m_MemoryUsage -= m_Footprints.takeFirst().second;
+
+        // Push drops the redo part and adds (or merges into) the command before the index, undo
+        // and redo change nothing. So only the tail starting from the last done command is updated
+        while (m_Footprints.size() > count)
+            m_MemoryUsage -= m_Footprints.takeLast().second;
+
+        for (int i = qMax(0, qMin(index - 1, m_Footprints.size())); i < count; ++i) {
+            const QUndoCommand *command = m_Stack->command(i);
+            const qint64 size = footprint(*command);
+            if (i < m_Footprints.size()) {
+                m_MemoryUsage += size - m_Footprints[i].second;
+                m_Footprints[i] = qMakePair(command, size);
+            } else {
+                m_MemoryUsage += size;
+                m_Footprints << qMakePair(command, size);
+            }
+        }
+
+        checkMemoryUsage();
+    }
+
+    /**
+     * @brief UndoMemoryLimiter::checkMemoryUsage
+     */
+    void UndoMemoryLimiter::checkMemoryUsage()
+    {
+        if (!m_Stack || m_MemoryLimit <= 0 || m_MemoryUsage <= m_MemoryLimit)
+            return;
+
+        // Number of the most recent done commands which fit into the limit, at least one
+        int undoLimit = 0;
+        qint64 usage = 0;
+        for (int i = m_Stack->index() - 1; i >= 0; --i) {
+            usage += m_Footprints[i].second;
+            if (usage > m_MemoryLimit && undoLimit > 0)
+                break;
+            ++undoLimit;
+        }
+        undoLimit = qMax(undoLimit, 1);
+        if (m_Stack->undoLimit() > 0)
+            undoLimit = qMin(undoLimit, m_Stack->undoLimit());
+
+        // The count limit can be changed only for an empty stack. Model state is not affected
+        const int dropped = m_Stack->count();
+        m_Stack->clear();
+        m_Stack->setUndoLimit(undoLimit);
+
+        m_Footprints.clear();
+        m_MemoryUsage = 0;
+
+        emit historyTrimmed(dropped, undoLimit);
+    }
+
+} // namespace Commands
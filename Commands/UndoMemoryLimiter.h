@@ -0,0 +1,72 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QObject>
+#include <QPair>
+#include <QPointer>
+#include <QVector>
+
+QT_BEGIN_NAMESPACE
+class QUndoCommand;
+class QUndoStack;
+QT_END_NAMESPACE
+
+namespace Commands {
+
+    /// The UndoMemoryLimiter class. Keeps track of memory used by commands in the stack. When the
+    /// limit is exceeded, the history is cleared and the count limit of the stack is set to the
+    /// number of the most recent commands which fit into the memory limit, so the stack drops the
+    /// oldest commands by itself afterwards
+    class UndoMemoryLimiter : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        explicit UndoMemoryLimiter(QUndoStack &stack, qint64 memoryLimit = 0,
+                                   QObject *parent = nullptr);
+
+        qint64 memoryLimit() const;
+        void setMemoryLimit(qint64 memoryLimit);
+
+        qint64 memoryUsage() const;
+
+        static qint64 footprint(const QUndoCommand &command);
+
+    signals:
+        void historyTrimmed(int droppedCount, int undoLimit);
+
+    private slots:
+        void onIndexChanged(int index);
+
+    private:
+        void checkMemoryUsage();
+
+        QPointer<QUndoStack> m_Stack;
+        qint64 m_MemoryLimit;
+        qint64 m_MemoryUsage;
+        /// Footprints of the commands in the stack, the oldest first
+        QVector<QPair<const QUndoCommand *, qint64>> m_Footprints;
+    };
+
+} // namespace Commands
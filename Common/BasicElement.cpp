@@ -29,6 +29,7 @@
 #include <Helpers/GeneratorID.h>
 
 #include <Common/Memento.hpp>
+#include <Common/StringPool.h>
 
 #include "enums.h"
 
@@ -199,6 +200,7 @@ namespace Common {
             m_Name = name;
 
             emit nameChanged(oldName, m_Name);
+            emit changed();
         }
     }
 
@@ -246,7 +248,7 @@ namespace Common {
     {
         using namespace Util;
 
-        checkAndSet(src, nameMark, errorList, [&](){ setName(src[nameMark].toString()); });
+        checkAndSet(src, nameMark, errorList, [&](){ setName(intern(src[nameMark].toString())); });
         checkAndSet(src, idMark, errorList, [&](){
             Common::ID tmpID;
             tmpID.fromJson(src[idMark], errorList);
@@ -305,19 +307,22 @@ namespace Common {
     /**
      * @brief BasicElement::importState
      * @param state
+     * @param currentState
      * @return
      */
-    OptErrLst BasicElement::importState(const Memento &state)
+    OptErrLst BasicElement::importState(const Memento &state, const Memento *currentState)
     {
         // Preserve current state
-        auto tmpObjJson = toJson();
+        auto tmpObjJson = currentState ? currentState->json() : toJson();
 
         // Load new state
         QStringList errors;
         fromJson(state.json(), errors);
 
-        if (errors.isEmpty())
+        if (errors.isEmpty()) {
+            emit changed();
             return std::nullopt;
+        }
 
         // Restore previous state
         QStringList tmpErrLst;
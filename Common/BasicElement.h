@@ -65,12 +65,15 @@ namespace Common {
         static QString staticMarker() noexcept;
 
         UniqueMemento exportState() const override;
-        OptErrLst importState(const Memento &state) override;
+        OptErrLst importState(const Memento &state, const Memento *currentState = nullptr) override;
 
     signals:
         void nameChanged(const QString &oldName, const QString &newName);
         void idChanged(const Common::ID &oldID, const Common::ID &newID);
 
+        // Emitted when anything visible in a signature of the element is changed
+        void changed();
+
     public slots:
         void setName(const QString &name);
 
@@ -32,7 +32,9 @@ namespace Common {
         virtual ~IOriginator();
 
         virtual UniqueMemento exportState() const = 0;
-        virtual OptErrLst importState(const Memento &state) = 0;
+
+        /// The current state, if it's known to a caller, is used to roll back on errors
+        virtual OptErrLst importState(const Memento &state, const Memento *currentState = nullptr) = 0;
     };
 
 } // Common
@@ -36,6 +36,16 @@ namespace Common {
         Q_ASSERT(!m_JsonObj.empty());
     }
 
+    /**
+     * @brief Memento::Memento
+     * @param json
+     */
+    Memento::Memento(QJsonObject json)
+        : m_JsonObj(std::move(json))
+    {
+        Q_ASSERT(!m_JsonObj.empty());
+    }
+
     /**
      * @brief Memento::json
      * @return
@@ -32,6 +32,7 @@ namespace Common {
     {
     public:
         Memento(const BasicElement &elem);
+        explicit Memento(QJsonObject json);
 
         QJsonObject json() const;
 
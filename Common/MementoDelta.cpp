@@ -0,0 +1,244 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "MementoDelta.hpp"
+
+#include <algorithm>
+
+#include <QObject>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+namespace Common {
+
+    namespace {
+
+        using Path = MementoDelta::Path;
+        using Changes = MementoDelta::Changes;
+
+        void diffValues(const QJsonValue &from, const QJsonValue &to, Path &path, Changes &out);
+
+        void diffObjects(const QJsonObject &from, const QJsonObject &to, Path &path, Changes &out)
+        {
+            for (auto it = from.begin(); it != from.end(); ++it)
+                if (!to.contains(it.key())) {
+                    path << it.key();
+                    out << MementoDelta::Change{MementoDelta::ChangeKind::Remove, path, {}};
+                    path.removeLast();
+                }
+
+            for (auto it = to.begin(); it != to.end(); ++it) {
+                path << it.key();
+                if (from.contains(it.key()))
+                    diffValues(from.value(it.key()), it.value(), path, out);
+                else
+                    out << MementoDelta::Change{MementoDelta::ChangeKind::Set, path, it.value()};
+                path.removeLast();
+            }
+        }
+
+        void diffArrays(const QJsonArray &from, const QJsonArray &to, Path &path, Changes &out)
+        {
+            // Skip common head and tail, so that inserting or removing an item in a large
+            // array (e.g. a method of a class) doesn't store the whole array
+            int head = 0;
+            const int minSize = std::min(from.size(), to.size());
+            while (head < minSize && from.at(head) == to.at(head))
+                ++head;
+
+            int tail = 0;
+            while (tail < minSize - head &&
+                   from.at(from.size() - tail - 1) == to.at(to.size() - tail - 1))
+                ++tail;
+
+            if (from.size() == to.size()) {
+                for (int i = head; i < from.size() - tail; ++i) {
+                    path << i;
+                    diffValues(from.at(i), to.at(i), path, out);
+                    path.removeLast();
+                }
+                return;
+            }
+
+            QJsonArray inserted;
+            for (int i = head; i < to.size() - tail; ++i)
+                inserted.append(to.at(i));
+
+            out << MementoDelta::Change{MementoDelta::ChangeKind::Splice, path, inserted,
+                                        head, from.size() - head - tail};
+        }
+
+        void diffValues(const QJsonValue &from, const QJsonValue &to, Path &path, Changes &out)
+        {
+            if (from == to)
+                return;
+
+            if (from.isObject() && to.isObject())
+                diffObjects(from.toObject(), to.toObject(), path, out);
+            else if (from.isArray() && to.isArray())
+                diffArrays(from.toArray(), to.toArray(), path, out);
+            else
+                out << MementoDelta::Change{MementoDelta::ChangeKind::Set, path, to};
+        }
+
+        QJsonValue applyChange(const QJsonValue &target, const MementoDelta::Change &change,
+                               int depth, QStringList &errorList)
+        {
+            if (depth == change.path.size()) {
+                if (change.kind == MementoDelta::ChangeKind::Set)
+                    return change.value;
+
+                auto array = target.toArray();
+                if (!target.isArray() || change.index + change.removeCount > array.size()) {
+                    errorList << QObject::tr("Cannot apply change: wrong array range.");
+                    return target;
+                }
+
+                for (int i = 0; i < change.removeCount; ++i)
+                    array.removeAt(change.index);
+
+                const auto inserted = change.value.toArray();
+                for (int i = 0; i < inserted.size(); ++i)
+                    array.insert(change.index + i, inserted.at(i));
+
+                return array;
+            }
+
+            const auto &step = change.path[depth];
+            const bool last = depth + 1 == change.path.size();
+
+            if (step.isString()) {
+                if (!target.isObject()) {
+                    errorList << QObject::tr("Cannot apply change: \"%1\" is not an object key.")
+                                 .arg(step.toString());
+                    return target;
+                }
+
+                auto object = target.toObject();
+                if (last && change.kind == MementoDelta::ChangeKind::Remove)
+                    object.remove(step.toString());
+                else
+                    object.insert(step.toString(),
+                                  applyChange(object.value(step.toString()), change, depth + 1,
+                                              errorList));
+                return object;
+            }
+
+            auto array = target.toArray();
+            const int index = step.toInt(-1);
+            if (!target.isArray() || index < 0 || index >= array.size()) {
+                errorList << QObject::tr("Cannot apply change: wrong array index %1.").arg(index);
+                return target;
+            }
+
+            array[index] = applyChange(array.at(index), change, depth + 1, errorList);
+            return array;
+        }
+
+        qint64 valueFootprint(const QJsonValue &value)
+        {
+            switch (value.type()) {
+                case QJsonValue::String:
+                    return value.toString().size() * qint64(sizeof(QChar));
+                case QJsonValue::Object:
+                    return QJsonDocument(value.toObject()).toJson(QJsonDocument::Compact).size();
+                case QJsonValue::Array:
+                    return QJsonDocument(value.toArray()).toJson(QJsonDocument::Compact).size();
+                default:
+                    return 0;
+            }
+        }
+    }
+
+    /**
+     * @brief MementoDelta::make
+     * @param from
+     * @param to
+     * @return delta which turns "from" state into "to" state
+     */
+    MementoDelta MementoDelta::make(const QJsonObject &from, const QJsonObject &to)
+    {
+        MementoDelta delta;
+
+        Path path;
+        diffObjects(from, to, path, delta.m_Changes);
+
+        delta.m_Footprint = qint64(sizeof(MementoDelta));
+        for (auto &&change : delta.m_Changes)
+            delta.m_Footprint += qint64(sizeof(Change)) + valueFootprint(change.value) +
+                                 change.path.size() * qint64(sizeof(QJsonValue));
+
+        return delta;
+    }
+
+    /**
+     * @brief MementoDelta::apply
+     * @param base
+     * @param errorList
+     * @return base state with all changes applied
+     */
+    QJsonObject MementoDelta::apply(const QJsonObject &base, QStringList &errorList) const
+    {
+        QJsonValue result(base);
+        for (auto &&change : m_Changes)
+            result = applyChange(result, change, 0, errorList);
+
+        return result.toObject();
+    }
+
+    /**
+     * @brief MementoDelta::isEmpty
+     * @return
+     */
+    bool MementoDelta::isEmpty() const
+    {
+        return m_Changes.isEmpty();
+    }
+
+    /**
+     * @brief MementoDelta::size
+     * @return
+     */
+    int MementoDelta::size() const
+    {
+        return m_Changes.size();
+    }
+
+    /**
+     * @brief MementoDelta::changes
+     * @return
+     */
+    MementoDelta::Changes MementoDelta::changes() const
+    {
+        return m_Changes;
+    }
+
+    /**
+     * @brief MementoDelta::footprint
+     * @return approximate size of stored changes, in bytes
+     */
+    qint64 MementoDelta::footprint() const
+    {
+        return m_Footprint;
+    }
+
+} // namespace Common
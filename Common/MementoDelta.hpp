@@ -0,0 +1,69 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QVector>
+
+namespace Common {
+
+    /// Structural difference between two JSON states. Only changed subtrees are stored,
+    /// unchanged values are shared with the source states by Qt implicit sharing
+    class MementoDelta
+    {
+    public: // Types
+        enum class ChangeKind { Set, Remove, Splice };
+
+        /// Path items are object keys (strings) or array indexes (numbers)
+        using Path = QVector<QJsonValue>;
+
+        struct Change
+        {
+            ChangeKind kind;
+            Path path;
+            QJsonValue value;     // New value for Set, inserted items for Splice
+            int index = 0;        // Splice only
+            int removeCount = 0;  // Splice only
+        };
+        using Changes = QVector<Change>;
+
+    public:
+        MementoDelta() = default;
+
+        static MementoDelta make(const QJsonObject &from, const QJsonObject &to);
+
+        QJsonObject apply(const QJsonObject &base, QStringList &errorList) const;
+
+        bool isEmpty() const;
+        int size() const;
+        Changes changes() const;
+
+        qint64 footprint() const;
+
+    private:
+        Changes m_Changes;
+        qint64 m_Footprint = 0;
+    };
+
+} // namespace Common
@@ -0,0 +1,110 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "StringPool.h"
+
+#include <QMutexLocker>
+
+namespace Common {
+
+    /**
+     * @brief StringPool::instance
+     * @return
+     */
+    StringPool &StringPool::instance()
+    {
+        static StringPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief StringPool::intern
+     * @param s
+     * @return string sharing the data with all equal interned strings
+     */
+    QString StringPool::intern(const QString &s)
+    {
+        // Null and empty strings already share the same data
+        if (s.isEmpty())
+            return s;
+
+        QMutexLocker locker(&m_Mutex);
+
+        auto it = m_Strings.constFind(s);
+        if (it == m_Strings.cend()) {
+            // Purge is amortized, it runs only when the table has doubled since the last one
+            if (m_Strings.size() >= m_PurgeThreshold) {
+                purgeUnused();
+                m_PurgeThreshold = qMax(minPurgeThreshold, m_Strings.size() * 2);
+            }
+
+            // Deep copy without reserved capacity, the source might be a part of a bigger buffer
+            it = m_Strings.insert(QString(s.constData(), s.size()));
+        }
+
+        return *it;
+    }
+
+    /**
+     * @brief StringPool::purge
+     */
+    void StringPool::purge()
+    {
+        QMutexLocker locker(&m_Mutex);
+        purgeUnused();
+    }
+
+    /**
+     * @brief StringPool::purgeUnused
+     * Removes strings which data is not used by anyone except the pool.
+     */
+    void StringPool::purgeUnused()
+    {
+        for (auto it = m_Strings.begin(); it != m_Strings.end();) {
+            if (it->isDetached())
+                it = m_Strings.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    /**
+     * @brief StringPool::count
+     * @return
+     */
+    int StringPool::count() const
+    {
+        QMutexLocker locker(&m_Mutex);
+        return m_Strings.count();
+    }
+
+    /**
+     * @brief intern
+     * @param s
+     * @return
+     */
+    QString intern(const QString &s)
+    {
+        return StringPool::instance().intern(s);
+    }
+
+} // namespace Common
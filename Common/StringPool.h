@@ -0,0 +1,64 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QSet>
+#include <QMutex>
+#include <QString>
+
+#include "QtHelpers.h"
+
+namespace Common {
+
+    /// Process-wide table of interned strings. Equal interned strings share the same data, so
+    /// repeated identifiers don't occupy extra memory and are compared by the data pointer first.
+    /// Strings are interned when elements are loaded, strings used only by the pool are purged
+    /// when the table grows
+    class StringPool
+    {
+    public:
+        NEITHER_COPIABLE_NOR_MOVABLE(StringPool)
+
+        static StringPool &instance();
+
+        QString intern(const QString &s);
+        void purge();
+
+        int count() const;
+
+    private:
+        StringPool() = default;
+
+        void purgeUnused();
+
+        static constexpr int minPurgeThreshold = 1024;
+
+        mutable QMutex m_Mutex;
+        QSet<QString> m_Strings;
+        int m_PurgeThreshold = minPurgeThreshold;
+    };
+
+    /// Shortcut for StringPool::instance().intern(s)
+    QString intern(const QString &s);
+
+} // namespace Common
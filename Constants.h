@@ -45,5 +45,6 @@ namespace {
     static const QString DEFAULT_PROJECT_NAME = "empty_project";
     static const QString DEFAULT_PROJECT_PATH = "empty_path";
     static const QString PROJECT_FILE_EXTENTION = "qut";
+    static const QString PROJECT_JOURNAL_EXTENTION = "qutj";
     static const QString DATABASE_FILE_EXTENTION = "qutdb";
 }
@@ -0,0 +1,686 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "BinaryFormat.h"
+
+#include <QFile>
+#include <QHash>
+#include <QSaveFile>
+#include <QVector>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QCoreApplication>
+
+#include <cmath>
+#include <cstring>
+
+namespace DB {
+
+    namespace Binary {
+
+        namespace {
+
+            const char magic[] = {'Q', 'U', 'T', 'B'};
+            const int magicSize = int(sizeof(magic));
+            const quint8 currentVersion = 1;
+
+            const QString sectionsMark = "Scopes";
+
+            enum Tag : quint8
+            {
+                Null,
+                False,
+                True,
+                Integer,
+                Double,
+                String,
+                IdString,
+                Array,
+                Object,
+                Section,
+            };
+
+            QString tr(const char *text) { return QCoreApplication::translate("DB::Binary", text); }
+
+            void writeVarint(QByteArray &out, quint64 value)
+            {
+                while (value >= 0x80) {
+                    out.append(char(quint8(value) | 0x80));
+                    value >>= 7;
+                }
+                out.append(char(value));
+            }
+
+            quint64 zigzag(qint64 v) { return (quint64(v) << 1) ^ quint64(v >> 63); }
+            qint64 unzigzag(quint64 v) { return qint64(v >> 1) ^ -qint64(v & 1); }
+
+            /// Decimal string which can be restored from the number without losses
+            bool isIdString(const QString &s, quint64 &value)
+            {
+                if (s.isEmpty() || s.size() > 20 || (s.size() > 1 && s[0] == '0'))
+                    return false;
+
+                for (auto &&c : s)
+                    if (c < '0' || c > '9')
+                        return false;
+
+                bool ok = false;
+                value = s.toULongLong(&ok);
+                return ok;
+            }
+
+            class Writer
+            {
+            public:
+                QByteArray body;
+
+                void writeValue(const QJsonValue &value, bool isSection = false)
+                {
+                    if (isSection) {
+                        Writer section(m_Strings);
+                        section.writeValue(value);
+
+                        body.append(char(Section));
+                        writeVarint(body, quint64(section.body.size()));
+                        body.append(section.body);
+                        return;
+                    }
+
+                    switch (value.type()) {
+                        case QJsonValue::Bool:
+                            body.append(char(value.toBool() ? True : False));
+                            break;
+
+                        case QJsonValue::Double: {
+                            const double d = value.toDouble();
+                            if (std::trunc(d) == d && std::abs(d) < 9007199254740992.0 /*2^53*/ &&
+                                !(d == 0 && std::signbit(d))) {
+                                body.append(char(Integer));
+                                writeVarint(body, zigzag(qint64(d)));
+                            } else {
+                                body.append(char(Double));
+                                quint64 bits = 0;
+                                std::memcpy(&bits, &d, sizeof bits);
+                                for (int i = 0; i < 8; ++i)
+                                    body.append(char(quint8(bits >> (8 * i))));
+                            }
+                            break;
+                        }
+
+                        case QJsonValue::String: {
+                            const QString s = value.toString();
+                            quint64 id = 0;
+                            if (isIdString(s, id)) {
+                                body.append(char(IdString));
+                                writeVarint(body, id);
+                            } else {
+                                body.append(char(String));
+                                writeVarint(body, intern(s));
+                            }
+                            break;
+                        }
+
+                        case QJsonValue::Array:
+                            writeArray(value.toArray(), false);
+                            break;
+
+                        case QJsonValue::Object:
+                            writeObject(value.toObject());
+                            break;
+
+                        default:
+                            body.append(char(Null));
+                    }
+                }
+
+                void writeObject(const QJsonObject &object)
+                {
+                    body.append(char(Object));
+                    writeVarint(body, quint64(object.size()));
+                    for (auto it = object.begin(); it != object.end(); ++it) {
+                        writeVarint(body, intern(it.key()));
+                        if (it.key() == sectionsMark && it.value().isArray())
+                            writeArray(it.value().toArray(), true);
+                        else
+                            writeValue(it.value());
+                    }
+                }
+
+                void writeArray(const QJsonArray &array, bool sections)
+                {
+                    body.append(char(Array));
+                    writeVarint(body, quint64(array.size()));
+                    for (auto &&v : array)
+                        writeValue(v, sections);
+                }
+
+                QByteArray stringsTable() const
+                {
+                    QByteArray result;
+                    writeVarint(result, quint64(m_Strings.order.size()));
+                    for (auto &&s : m_Strings.order) {
+                        const QByteArray utf8 = s.toUtf8();
+                        writeVarint(result, quint64(utf8.size()));
+                        result.append(utf8);
+                    }
+
+                    return result;
+                }
+
+                Writer() : m_OwnStrings(), m_Strings(m_OwnStrings) {}
+
+            private:
+                struct Strings
+                {
+                    QHash<QString, quint64> indexes;
+                    QVector<QString> order;
+                };
+
+                explicit Writer(Strings &strings) : m_OwnStrings(), m_Strings(strings) {}
+
+                quint64 intern(const QString &s)
+                {
+                    auto it = m_Strings.indexes.find(s);
+                    if (it != m_Strings.indexes.end())
+                        return *it;
+
+                    const quint64 index = quint64(m_Strings.order.size());
+                    m_Strings.indexes.insert(s, index);
+                    m_Strings.order << s;
+
+                    return index;
+                }
+
+                Strings m_OwnStrings;
+                Strings &m_Strings;
+            };
+
+        } // namespace
+
+        /**
+         * @brief Reader::Reader
+         * @param data
+         * @param size
+         */
+        Reader::Reader(const char *data, qint64 size)
+            : m_Data(data)
+            , m_Size(size)
+            , m_Pos(0)
+        {}
+
+        /**
+         * @brief Reader::readHeader
+         * @return
+         */
+        bool Reader::readHeader()
+        {
+            if (m_Size < magicSize + 1 || std::memcmp(m_Data, magic, magicSize) != 0)
+                return fail(tr("Wrong binary database signature."));
+
+            m_Pos = magicSize;
+            const quint8 version = quint8(m_Data[m_Pos++]);
+            if (version > currentVersion)
+                return fail(tr("Unsupported binary database version: %1.").arg(int(version)));
+
+            quint64 count = 0;
+            if (!readVarint(count))
+                return false;
+
+            m_Strings.clear();
+            m_Strings.reserve(int(qMin<quint64>(count, quint64(m_Size))));
+            for (quint64 i = 0; i < count; ++i) {
+                quint64 length = 0;
+                if (!readVarint(length) || length > quint64(m_Size - m_Pos))
+                    return fail(tr("Corrupted strings table."));
+
+                m_Strings << QString::fromUtf8(m_Data + m_Pos, int(length));
+                m_Pos += qint64(length);
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Reader::readValue
+         * @param value
+         * @return
+         */
+        bool Reader::readValue(QJsonValue &value)
+        {
+            quint8 tag = 0;
+            if (!readTag(tag))
+                return false;
+
+            switch (tag) {
+                case Null:  value = QJsonValue(); return true;
+                case False: value = false; return true;
+                case True:  value = true;  return true;
+
+                case Integer: {
+                    quint64 v = 0;
+                    if (!readVarint(v))
+                        return false;
+                    value = QJsonValue(unzigzag(v));
+                    return true;
+                }
+
+                case Double: {
+                    if (m_Size - m_Pos < 8)
+                        return fail(tr("Unexpected end of binary database."));
+                    quint64 bits = 0;
+                    for (int i = 0; i < 8; ++i)
+                        bits |= quint64(quint8(m_Data[m_Pos++])) << (8 * i);
+                    double d = 0;
+                    std::memcpy(&d, &bits, sizeof d);
+                    value = d;
+                    return true;
+                }
+
+                case String:
+                case IdString: {
+                    QString s;
+                    if (!readStringValue(tag, s))
+                        return false;
+                    value = s;
+                    return true;
+                }
+
+                case Array: {
+                    quint64 count = 0;
+                    if (!readVarint(count))
+                        return false;
+
+                    QJsonArray array;
+                    for (quint64 i = 0; i < count; ++i) {
+                        QJsonValue v;
+                        if (!readValue(v))
+                            return false;
+                        array.append(v);
+                    }
+                    value = array;
+                    return true;
+                }
+
+                case Object: {
+                    quint64 count = 0;
+                    if (!readVarint(count))
+                        return false;
+
+                    QJsonObject object;
+                    for (quint64 i = 0; i < count; ++i) {
+                        QString key;
+                        QJsonValue v;
+                        if (!readKey(key) || !readValue(v))
+                            return false;
+                        object.insert(key, v);
+                    }
+                    value = object;
+                    return true;
+                }
+
+                default:
+                    return fail(tr("Unknown value tag."));
+            }
+        }
+
+        /**
+         * @brief Reader::skipValue
+         * @return
+         */
+        bool Reader::skipValue()
+        {
+            if (m_Pos >= m_Size)
+                return fail(tr("Unexpected end of binary database."));
+
+            // Sections are skipped without looking inside
+            if (quint8(m_Data[m_Pos]) == Section) {
+                ++m_Pos;
+                quint64 size = 0;
+                if (!readVarint(size) || size > quint64(m_Size - m_Pos))
+                    return fail(tr("Corrupted section."));
+
+                m_Pos += qint64(size);
+                return true;
+            }
+
+            QJsonValue stub;
+            return readValue(stub);
+        }
+
+        /**
+         * @brief Reader::beginObject
+         * @param count
+         * @return
+         */
+        bool Reader::beginObject(quint64 &count)
+        {
+            return beginContainer(Object, count);
+        }
+
+        /**
+         * @brief Reader::beginArray
+         * @param count
+         * @return
+         */
+        bool Reader::beginArray(quint64 &count)
+        {
+            return beginContainer(Array, count);
+        }
+
+        /**
+         * @brief Reader::readKey
+         * @param key
+         * @return
+         */
+        bool Reader::readKey(QString &key)
+        {
+            quint64 index = 0;
+            if (!readVarint(index))
+                return false;
+
+            if (index >= quint64(m_Strings.size()))
+                return fail(tr("Wrong string index."));
+
+            key = m_Strings[int(index)];
+            return true;
+        }
+
+        /**
+         * @brief Reader::readString
+         * @param s
+         * @return
+         */
+        bool Reader::readString(QString &s)
+        {
+            quint8 tag = 0;
+            return readTag(tag) && readStringValue(tag, s);
+        }
+
+        /**
+         * @brief Reader::pos
+         * @return
+         */
+        qint64 Reader::pos() const
+        {
+            return m_Pos;
+        }
+
+        /**
+         * @brief Reader::seek
+         * @param pos
+         * @return
+         */
+        bool Reader::seek(qint64 pos)
+        {
+            if (pos < 0 || pos > m_Size)
+                return fail(tr("Wrong position in binary database."));
+
+            m_Pos = pos;
+            return true;
+        }
+
+        /**
+         * @brief Reader::atEnd
+         * @return
+         */
+        bool Reader::atEnd() const
+        {
+            return m_Pos == m_Size;
+        }
+
+        /**
+         * @brief Reader::errors
+         * @return
+         */
+        ErrorList Reader::errors() const
+        {
+            return m_Errors;
+        }
+
+        /**
+         * @brief Reader::fail
+         * @param message
+         * @return
+         */
+        bool Reader::fail(const QString &message)
+        {
+            m_Errors << message;
+            return false;
+        }
+
+        /**
+         * @brief Reader::readVarint
+         * @param value
+         * @return
+         */
+        bool Reader::readVarint(quint64 &value)
+        {
+            value = 0;
+            for (int shift = 0; shift < 64 && m_Pos < m_Size; shift += 7) {
+                const quint8 byte = quint8(m_Data[m_Pos++]);
+                value |= quint64(byte & 0x7f) << shift;
+                if (!(byte & 0x80))
+                    return true;
+            }
+
+            return fail(tr("Corrupted number."));
+        }
+
+        /**
+         * @brief Reader::readTag
+         * @param tag
+         * @return
+         */
+        bool Reader::readTag(quint8 &tag)
+        {
+            // Sections are transparent for the content reading
+            while (m_Pos < m_Size) {
+                tag = quint8(m_Data[m_Pos++]);
+                if (tag != Section)
+                    return true;
+
+                quint64 size = 0;
+                if (!readVarint(size) || size > quint64(m_Size - m_Pos))
+                    return fail(tr("Corrupted section."));
+            }
+
+            return fail(tr("Unexpected end of binary database."));
+        }
+
+        /**
+         * @brief Reader::readStringValue
+         * @param tag
+         * @param s
+         * @return
+         */
+        bool Reader::readStringValue(quint8 tag, QString &s)
+        {
+            if (tag == String)
+                return readKey(s);
+
+            if (tag == IdString) {
+                quint64 v = 0;
+                if (!readVarint(v))
+                    return false;
+                s = QString::number(v);
+                return true;
+            }
+
+            return fail(tr("String is expected."));
+        }
+
+        /**
+         * @brief Reader::beginContainer
+         * @param expectedTag
+         * @param count
+         * @return
+         */
+        bool Reader::beginContainer(quint8 expectedTag, quint64 &count)
+        {
+            quint8 tag = 0;
+            if (!readTag(tag))
+                return false;
+
+            if (tag != expectedTag)
+                return fail(expectedTag == Object ? tr("Object is expected.")
+                                                  : tr("Array is expected."));
+
+            return readVarint(count);
+        }
+
+        /**
+         * @brief isBinary
+         * @param data
+         * @return
+         */
+        bool isBinary(const QByteArray &data)
+        {
+            return data.size() >= magicSize && std::memcmp(data.constData(), magic, magicSize) == 0;
+        }
+
+        /**
+         * @brief toBinary
+         * @param object
+         * @return
+         */
+        QByteArray toBinary(const QJsonObject &object)
+        {
+            Writer writer;
+            writer.writeObject(object);
+
+            QByteArray result(magic, magicSize);
+            result.append(char(currentVersion));
+            result.append(writer.stringsTable());
+            result.append(writer.body);
+
+            return result;
+        }
+
+        /**
+         * @brief fromBinary
+         * @param data
+         * @param errors
+         * @return
+         */
+        QJsonObject fromBinary(const QByteArray &data, ErrorList &errors)
+        {
+            Reader reader(data.constData(), data.size());
+            QJsonValue root;
+            if (!reader.readHeader() || !reader.readValue(root)) {
+                errors << reader.errors();
+                return QJsonObject();
+            }
+
+            if (!root.isObject() || !reader.atEnd()) {
+                errors << tr("Wrong binary database content.");
+                return QJsonObject();
+            }
+
+            return root.toObject();
+        }
+
+        /**
+         * @brief readFile
+         * @param fileName
+         * @param errors
+         * @return
+         */
+        QJsonObject readFile(const QString &fileName, ErrorList &errors)
+        {
+            QFile f(fileName);
+            if (!f.open(QIODevice::ReadOnly)) {
+                errors << tr("Cannot load database: %1.").arg(fileName);
+                return QJsonObject();
+            }
+
+            const QByteArray data = f.readAll();
+            if (isBinary(data))
+                return fromBinary(data, errors);
+
+            QJsonParseError errorMessage;
+            QJsonDocument jdoc(QJsonDocument::fromJson(data, &errorMessage));
+            if (errorMessage.error != QJsonParseError::NoError) {
+                errors << errorMessage.errorString();
+                return QJsonObject();
+            }
+
+            return jdoc.object();
+        }
+
+        /**
+         * @brief writeFile
+         * @param object
+         * @param fileName
+         * @param binary
+         * @return
+         */
+        bool writeFile(const QJsonObject &object, const QString &fileName, bool binary)
+        {
+            // Data is written to a temporary file which replaces the target one only on
+            // success, so an interrupted save never leaves a truncated file
+            QSaveFile f(fileName);
+            if (!f.open(QIODevice::WriteOnly))
+                return false;
+
+            const QByteArray data = binary ? toBinary(object) : QJsonDocument(object).toJson();
+            if (f.write(data) != data.size()) {
+                f.cancelWriting();
+                return false;
+            }
+
+            return f.commit();
+        }
+
+        /**
+         * @brief convert
+         * @param srcFileName
+         * @param dstFileName
+         * @param errors
+         * @return
+         */
+        bool convert(const QString &srcFileName, const QString &dstFileName, ErrorList &errors)
+        {
+            QFile f(srcFileName);
+            if (!f.open(QIODevice::ReadOnly)) {
+                errors << tr("Cannot load database: %1.").arg(srcFileName);
+                return false;
+            }
+
+            // Convert to the opposite format
+            const bool toBinaryFormat = !isBinary(f.peek(magicSize));
+            f.close();
+
+            auto object = readFile(srcFileName, errors);
+            if (!errors.isEmpty())
+                return false;
+
+            if (!writeFile(object, dstFileName, toBinaryFormat)) {
+                errors << tr("Cannot save database: %1.").arg(dstFileName);
+                return false;
+            }
+
+            return true;
+        }
+
+    } // namespace Binary
+
+} // namespace DB
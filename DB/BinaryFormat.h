@@ -0,0 +1,87 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QVector>
+
+#include "types.h"
+
+namespace DB {
+
+    /// Compact binary container for the database JSON tree.
+    /// Layout: magic, version, interned strings table, root value. Decimal ID strings are
+    /// stored as varints and each element of "Scopes" arrays is a length-prefixed section.
+    namespace Binary {
+
+        /// Forward-only reader over binary data, sections are transparent for it.
+        /// The data should outlive the reader
+        class Reader
+        {
+        public:
+            Reader(const char *data, qint64 size);
+
+            bool readHeader();
+
+            bool readValue(QJsonValue &value);
+            bool skipValue();
+
+            bool beginObject(quint64 &count);
+            bool beginArray(quint64 &count);
+            bool readKey(QString &key);
+            bool readString(QString &s);
+
+            qint64 pos() const;
+            bool seek(qint64 pos);
+            bool atEnd() const;
+
+            ErrorList errors() const;
+
+        private:
+            bool fail(const QString &message);
+            bool readVarint(quint64 &value);
+            bool readTag(quint8 &tag);
+            bool readStringValue(quint8 tag, QString &s);
+            bool beginContainer(quint8 expectedTag, quint64 &count);
+
+            const char *m_Data;
+            qint64 m_Size;
+            qint64 m_Pos;
+            QVector<QString> m_Strings;
+            ErrorList m_Errors;
+        };
+
+        bool isBinary(const QByteArray &data);
+
+        QByteArray toBinary(const QJsonObject &object);
+        QJsonObject fromBinary(const QByteArray &data, ErrorList &errors);
+
+        QJsonObject readFile(const QString &fileName, ErrorList &errors);
+        bool writeFile(const QJsonObject &object, const QString &fileName, bool binary);
+
+        bool convert(const QString &srcFileName, const QString &dstFileName, ErrorList &errors);
+
+    } // namespace Binary
+
+} // namespace DB
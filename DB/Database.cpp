@@ -25,22 +25,50 @@
 
 #include <QDir>
 #include <QFile>
+#include <QThread>
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QJsonArray>
-#include <QTextStream>
 #include <QDebug>
 
 #include <Utility/helpfunctions.h>
 #include <Helpers/entityhelpres.h>
 
 #include <Entity/Scope.h>
+#include <Entity/Type.h>
+#include <Entity/EntityFactory.h>
 #include <Common/ID.h>
 
 #include "Constants.h"
+#include "BinaryFormat.h"
 
 namespace DB {
 
+    namespace {
+
+        void addUnloadedTypes(QJsonObject &scope, const Database::UnloadedTypes &types)
+        {
+            auto it = types.constFind(scope["ID"].toString());
+            if (it != types.cend()) {
+                QJsonArray scopeTypes = scope["Types"].toArray();
+                for (auto &&type : *it)
+                    scopeTypes.append(type);
+                scope["Types"] = scopeTypes;
+            }
+
+            QJsonArray children = scope["Scopes"].toArray();
+            if (!children.isEmpty()) {
+                for (auto &&child : children) {
+                    QJsonObject childObject = child.toObject();
+                    addUnloadedTypes(childObject, types);
+                    child = childObject;
+                }
+                scope["Scopes"] = children;
+            }
+        }
+
+    } // namespace
+
     /**
      * @brief Database::Database
      * @param src
@@ -70,6 +98,8 @@ namespace DB {
         , m_Path(path)
         , m_ID(Common::ID::nullID())
         , m_Valid(false)
+        , m_LoadMode(LoadMode::Lazy)
+        , m_Format(Format::Json)
     {
     }
 
@@ -112,6 +142,9 @@ namespace DB {
      */
     bool operator ==(const Database &lhs, const Database &rhs)
     {
+        lhs.materialize();
+        rhs.materialize();
+
         return lhs.m_Name == rhs.m_Name &&
                lhs.m_Path == rhs.m_Path &&
                lhs.m_ID   == rhs.m_ID   &&
@@ -171,12 +204,18 @@ namespace DB {
      */
     Entity::SharedScope Database::scope(const Common::ID &id, bool searchInDepth) const
     {
+        Entity::SharedScope result;
         if (!searchInDepth) {
             auto it = m_Scopes.find(id);
-            return it != m_Scopes.end() ? *it : nullptr;
+            result = it != m_Scopes.end() ? *it : nullptr;
         } else {
-            return depthScopeSearch(id);
+            result = depthScopeSearch(id);
         }
+
+        if (result)
+            materializeScope(result->id());
+
+        return result;
     }
 
     /**
@@ -192,19 +231,16 @@ namespace DB {
         if (!parentScopeId.isValid()) {
             scope = std::make_shared<Entity::Scope>(name, Common::ID::globalScopeID());
             m_Scopes[scope->id()] = scope;
+            connectScope(scope.get());
+            indexScope(scope, scope->scopeId());
         } else {
-            auto searchResults = std::move(makeDepthIdList(parentScopeId));
-            if (!searchResults.isEmpty()) {
-                auto depthScope = getScopeWithDepthList(searchResults);
-                if (depthScope)
-                    scope = depthScope->addChildScope(name);
-            }
+            // Child scopes are observed through the top level scope
+            if (auto depthScope = depthScopeSearch(parentScopeId))
+                scope = depthScope->addChildScope(name);
         }
 
-        if (scope) {
-            connectScope(scope.get());
+        if (scope)
             emit scopeAdded(scope);
-        }
 
         return scope;
     }
@@ -221,6 +257,7 @@ namespace DB {
         Q_ASSERT(!m_Scopes.contains(scope->id()));
         m_Scopes[scope->id()] = scope;
         connectScope(scope.get());
+        indexScope(scope, scope->scopeId());
 
         emit scopeAdded(scope);
 
@@ -234,7 +271,11 @@ namespace DB {
      */
     Entity::SharedScope Database::chainScopeSearch(const QStringList &scopesNames) const
     {
-        return Entity::chainScopeSearch(m_Scopes, scopesNames);
+        auto result = Entity::chainScopeSearch(m_Scopes, scopesNames);
+        if (result)
+            materializeScope(result->id());
+
+        return result;
     }
 
     /**
@@ -262,10 +303,13 @@ namespace DB {
      */
     void Database::removeScope(const Common::ID &id)
     {
+        materialize();
+
         if (auto it = m_Scopes.find(id); it != m_Scopes.end()) {
             auto scope = *it;
             connectScope(scope.get(), false /*connect*/);
             m_Scopes.remove(scope->id());
+            indexScope(scope, scope->scopeId(), false /*add*/);
 
             emit scopeRemoved(scope);
         }
@@ -277,6 +321,9 @@ namespace DB {
      */
     Entity::ScopesList Database::scopes() const
     {
+        // Callers are free to walk the whole tree
+        materialize();
+
         return m_Scopes.values().toVector();
     }
 
@@ -295,6 +342,7 @@ namespace DB {
             Q_ASSERT(scope->id() == newID);
 
             m_Scopes[newID] = scope;
+            rekeyScope(oldID, newID);
         } else {
             qWarning() << "Wrong new scope ID: " << newID.value() << ", old was: " << oldID.value();
         }
@@ -307,40 +355,18 @@ namespace DB {
      */
     Entity::SharedScope Database::depthScopeSearch(const Common::ID &id) const
     {
-        return getScopeWithDepthList(makeDepthIdList(id));
+        return m_ScopesIndex.value(id).scope;
     }
 
-    namespace
+    /**
+     * @brief Database::parentScopeID
+     * @param scopeID
+     * @return
+     */
+    Common::ID Database::parentScopeID(const Common::ID &scopeID) const
     {
-        template <class IDType>
-        void getDepthType(const Entity::SharedScope &scope, const IDType &id,
-                          Entity::SharedType &result)
-        {
-            if (scope->containsType(id)) {
-                result = scope->type(id);
-                return;
-            } else if (scope->hasChildScopes()){
-                for (auto &&child_scope : scope->scopes()) {
-                    if (result)
-                        break;
-                    getDepthType(child_scope, id, result);
-                }
-            }
-        }
-
-        template <class IDType>
-        Entity::SharedType typeSearchImpl(const IDType &typeId, const Entity::Scopes &scopes)
-        {
-            Entity::SharedType result;
-
-            for (auto &&scope : scopes.values()) {
-                getDepthType(scope, typeId, result);
-                if (result)
-                    break;
-            }
-
-            return result;
-        }
+        auto it = m_ScopesIndex.find(scopeID);
+        return it != m_ScopesIndex.end() ? it->parentID : Common::ID::nullID();
     }
 
     /**
@@ -350,7 +376,10 @@ namespace DB {
      */
     Entity::SharedType Database::typeByID(const Common::ID &typeId) const
     {
-        return typeSearchImpl(typeId, m_Scopes);
+        if (auto type = m_TypesIndex.value(typeId))
+            return type;
+
+        return materializeType(typeId);
     }
 
     /**
@@ -360,81 +389,136 @@ namespace DB {
      */
     Entity::SharedType Database::typeByName(const QString &name) const
     {
-        return typeSearchImpl(name, m_Scopes);
+        // Qualified name, e.g. "std::vector"
+        if (name.contains("::")) {
+            QStringList names = name.split("::", QString::SkipEmptyParts);
+            if (names.isEmpty())
+                return nullptr;
+
+            auto typeName = names.takeLast();
+            if (names.isEmpty())
+                return typeByName(typeName);
+
+            auto scope = chainScopeSearch(names);
+            return scope ? scope->type(typeName) : nullptr;
+        }
+
+        if (auto type = m_TypesNameIndex.value(name))
+            return type;
+
+        if (m_Loader)
+            if (auto id = m_Loader->findType(name))
+                return materializeType(*id);
+
+        return nullptr;
     }
 
     /**
-     * @brief Database::makeDepthIdList
-     * @param id
-     * @return
+     * @brief Database::load
+     * @param errorList
      */
-    Database::IDList Database::makeDepthIdList(const Common::ID &id) const
+    void Database::load(ErrorList &errorList)
     {
-        IDList result;
-
-        if (containsScope(id)) {
-            result << id;
+        auto loader = m_LoadMode == LoadMode::Lazy ? std::make_unique<LazyLoader>() : nullptr;
+        if (loader && loader->open(makeFullPath())) {
+            m_Format = loader->isBinary() ? Format::Binary : Format::Json;
+            loadLazy(std::move(loader));
         } else {
-            for (auto scope : m_Scopes.values()) {
-                recursiveFind(scope, id, result);
-                if (!result.empty()) break;
+            // Also used as a fallback, if the file cannot be indexed
+            QFile f(makeFullPath());
+            if (f.open(QIODevice::ReadOnly)) {
+                const QByteArray data = f.readAll();
+                m_Format = Binary::isBinary(data) ? Format::Binary : Format::Json;
+                if (m_Format == Format::Binary) {
+                    auto object = Binary::fromBinary(data, errorList);
+                    if (errorList.isEmpty())
+                        fromJson(object, errorList);
+                } else {
+                    QJsonParseError errorMessage;
+                    QJsonDocument jdoc(QJsonDocument::fromJson(data, &errorMessage));
+
+                    if (errorMessage.error == QJsonParseError::NoError) {
+                        fromJson(jdoc.object(), errorList);
+                    } else {
+                        errorList << errorMessage.errorString();
+                    }
+                }
+            } else {
+                errorList << QObject::tr("Cannot load database: %1.").arg(f.fileName());
             }
         }
 
-        return result;
+        m_Valid = errorList.isEmpty();
+
+        emit loaded();
     }
 
     /**
-     * @brief Database::getScopeWithDepthList
-     * @param ids
-     * @return
+     * @brief Database::clear
      */
-    Entity::SharedScope Database::getScopeWithDepthList(const IDList &ids) const
+    void Database::clear()
     {
-        Entity::SharedScope result(nullptr);
-        if (!ids.isEmpty() && containsScope(ids[0])) {
-            result = scope(ids[0]);
-            for (int i = 1, size = ids.size(); i < size; ++i)
-                if (result->containsChildScope(ids[i]))
-                    result = result->getChildScope(ids[i]);
-                else
-                    break;
-        }
+        for (auto &&scope : m_Scopes)
+            connectScope(scope.get(), false /*connect*/);
 
-        return result;
+        m_Scopes.clear();
+        m_TypesIndex.clear();
+        m_TypesNameIndex.clear();
+        m_ScopesIndex.clear();
+
+        m_Loader.reset();
+        m_UnloadedTypes.clear();
+        m_Errors.clear();
     }
 
     /**
-     * @brief Database::load
-     * @param errorList
+     * @brief Database::loadMode
+     * @return
      */
-    void Database::load(ErrorList &errorList)
+    Database::LoadMode Database::loadMode() const
     {
-        QFile f(makeFullPath());
-        if (f.open(QIODevice::ReadOnly)) {
-            QJsonParseError errorMessage;
-            QJsonDocument jdoc(QJsonDocument::fromJson(f.readAll(), &errorMessage));
+        return m_LoadMode;
+    }
 
-            if (errorMessage.error == QJsonParseError::NoError) {
-                fromJson(jdoc.object(), errorList);
-            } else {
-                errorList << errorMessage.errorString();
-            }
-        } else {
-            errorList << QObject::tr("Cannot load database: %1.").arg(f.fileName());
-        }
+    /**
+     * @brief Database::setLoadMode
+     * @param mode
+     */
+    void Database::setLoadMode(LoadMode mode)
+    {
+        m_LoadMode = mode;
+    }
 
-        m_Valid = errorList.isEmpty();
+    /**
+     * @brief Database::format
+     * @return
+     */
+    Database::Format Database::format() const
+    {
+        return m_Format;
+    }
 
-        emit loaded();
+    /**
+     * @brief Database::setFormat
+     * @param format
+     */
+    void Database::setFormat(Format format)
+    {
+        m_Format = format;
     }
 
     /**
-     * @brief Database::clear
+     * @brief Database::materialize
      */
-    void Database::clear()
+    void Database::materialize() const
     {
-        m_Scopes.clear();
+        if (!m_Loader)
+            return;
+
+        for (auto &&id : m_Loader->pendingTypes())
+            materializeType(id);
+
+        releaseLoader();
     }
 
     /**
@@ -443,19 +527,14 @@ namespace DB {
      */
     bool Database::save() const
     {
+        // Also unmaps the file before overwriting it
+        materialize();
+
         if (!QDir(m_Path).exists())
             if (!QDir().mkpath(m_Path))
                 return false;
 
-        QFile f(makeFullPath());
-        if (f.open(QIODevice::WriteOnly)) {
-            QJsonDocument jdoc(toJson());
-            QTextStream stream(&f);
-            stream << jdoc.toJson();
-            return true;
-        }
-
-        return false;
+        return Binary::writeFile(toJson(), makeFullPath(), m_Format == Format::Binary);
     }
 
     /**
@@ -464,9 +543,16 @@ namespace DB {
      */
     QJsonObject Database::toJson() const
     {
+        materialize();
+
         QJsonArray scopes;
-        for (auto &&scope : m_Scopes.values())
-            scopes.append(scope->toJson());
+        for (auto &&scope : m_Scopes.values()) {
+            QJsonObject scopeObject = scope->toJson();
+            if (!m_UnloadedTypes.isEmpty())
+                addUnloadedTypes(scopeObject, m_UnloadedTypes);
+
+            scopes.append(scopeObject);
+        }
 
         QJsonObject result;
         result.insert("Name", m_Name);
@@ -537,6 +623,15 @@ namespace DB {
         m_ID = ID;
     }
 
+    /**
+     * @brief Database::lastErrors
+     * @return errors of types creation in the lazy mode
+     */
+    ErrorList Database::lastErrors() const
+    {
+        return m_Errors;
+    }
+
     /**
      * @brief Database::valid
      * @return
@@ -586,8 +681,25 @@ namespace DB {
         m_Path  = std::move(src.m_Path);
         m_ID    = std::move(src.m_ID);
         m_Valid = std::move(src.m_Valid);
+        m_LoadMode = src.m_LoadMode;
+        m_Format = src.m_Format;
+        m_Loader = std::move(src.m_Loader);
+        m_UnloadedTypes = std::move(src.m_UnloadedTypes);
+        m_Errors = std::move(src.m_Errors);
+
+        for (auto &&scope : m_Scopes)
+            connectScope(scope.get(), false /*connect*/);
+
+        for (auto &&scope : src.m_Scopes)
+            src.connectScope(scope.get(), false /*connect*/);
 
         m_Scopes = std::move(src.m_Scopes);
+        m_TypesIndex = std::move(src.m_TypesIndex);
+        m_TypesNameIndex = std::move(src.m_TypesNameIndex);
+        m_ScopesIndex = std::move(src.m_ScopesIndex);
+
+        for (auto &&scope : m_Scopes)
+            connectScope(scope.get());
     }
 
     /**
@@ -600,8 +712,18 @@ namespace DB {
         m_Path  = src.m_Path;
         m_ID    = src.m_ID;
         m_Valid = src.m_Valid;
+        m_LoadMode = src.m_LoadMode;
+        m_Format = src.m_Format;
 
+        src.materialize();
         Util::deepCopySharedPointerHash(src.m_Scopes, m_Scopes, &Entity::Scope::id);
+        m_UnloadedTypes = src.m_UnloadedTypes;
+        m_Errors = src.m_Errors;
+
+        for (auto &&scope : m_Scopes)
+            connectScope(scope.get());
+
+        rebuildIndex();
     }
 
     /**
@@ -614,38 +736,295 @@ namespace DB {
     }
 
     /**
-     * @brief Database::recursiveFind
+     * @brief Database::connectScope
      * @param scope
-     * @param id
-     * @param ids
+     * @param connect
      */
-    void Database::recursiveFind(Entity::SharedScope scope, const Common::ID &id, IDList &ids) const
+    void Database::connectScope(Entity::Scope *scope, bool connect)
     {
-        if (scope->scopes().isEmpty())  {
-            ids.clear();
-            return;
+        if (connect) {
+            G_CONNECT(scope, &Common::BasicElement::idChanged, this, &Database::onScopeIDChanged);
+            G_CONNECT(scope, &Entity::Scope::typeAdded, this, &Database::onTypeAdded);
+            G_CONNECT(scope, &Entity::Scope::typeRemoved, this, &Database::onTypeRemoved);
+            G_CONNECT(scope, &Entity::Scope::typeRenamed, this, &Database::onTypeRenamed);
+            G_CONNECT(scope, &Entity::Scope::typeIdChanged, this, &Database::onTypeIdChanged);
+            G_CONNECT(scope, &Entity::Scope::childScopeAdded, this, &Database::onChildScopeAdded);
+            G_CONNECT(scope, &Entity::Scope::childScopeRemoved, this, &Database::onChildScopeRemoved);
+            G_CONNECT(scope, &Entity::Scope::childScopeIdChanged, this, &Database::onChildScopeIdChanged);
+        } else {
+            G_DISCONNECT(scope, &Common::BasicElement::idChanged, this, &Database::onScopeIDChanged);
+            G_DISCONNECT(scope, &Entity::Scope::typeAdded, this, &Database::onTypeAdded);
+            G_DISCONNECT(scope, &Entity::Scope::typeRemoved, this, &Database::onTypeRemoved);
+            G_DISCONNECT(scope, &Entity::Scope::typeRenamed, this, &Database::onTypeRenamed);
+            G_DISCONNECT(scope, &Entity::Scope::typeIdChanged, this, &Database::onTypeIdChanged);
+            G_DISCONNECT(scope, &Entity::Scope::childScopeAdded, this, &Database::onChildScopeAdded);
+            G_DISCONNECT(scope, &Entity::Scope::childScopeRemoved, this, &Database::onChildScopeRemoved);
+            G_DISCONNECT(scope, &Entity::Scope::childScopeIdChanged, this, &Database::onChildScopeIdChanged);
         }
+    }
 
-        ids << scope->id();
+    /**
+     * @brief Database::onTypeAdded
+     * @param type
+     */
+    void Database::onTypeAdded(const Entity::SharedType &type)
+    {
+        indexType(type);
+    }
 
-        if (scope->containsChildScope(id))
-            ids << scope->getChildScope(id)->id();
-        else
-            for (auto &&sc : scope->scopes())
-                recursiveFind(sc, id, ids);
+    /**
+     * @brief Database::onTypeRemoved
+     * @param type
+     */
+    void Database::onTypeRemoved(const Entity::SharedType &type)
+    {
+        unindexType(type);
+        emit typeRemoved(type);
     }
 
     /**
-     * @brief Database::connectScope
+     * @brief Database::onTypeRenamed
+     * @param type
+     * @param oldName
+     */
+    void Database::onTypeRenamed(const Entity::SharedType &type, const QString &oldName)
+    {
+        if (m_TypesNameIndex.remove(oldName, type) != 0)
+            m_TypesNameIndex.insert(type->name(), type);
+
+        emit typeRenamed(type, oldName);
+    }
+
+    /**
+     * @brief Database::onTypeIdChanged
+     * @param type
+     * @param oldID
+     */
+    void Database::onTypeIdChanged(const Entity::SharedType &type, const Common::ID &oldID)
+    {
+        if (auto it = m_TypesIndex.find(oldID); it != m_TypesIndex.end() && *it == type) {
+            m_TypesIndex.erase(it);
+            m_TypesIndex[type->id()] = type;
+        }
+
+        emit typeIdChanged(type, oldID);
+    }
+
+    /**
+     * @brief Database::onChildScopeAdded
      * @param scope
-     * @param connect
      */
-    void Database::connectScope(Entity::Scope *scope, bool connect)
+    void Database::onChildScopeAdded(const Entity::SharedScope &scope)
     {
-        if (connect)
-            G_CONNECT(scope, &Common::BasicElement::idChanged, this, &Database::onScopeIDChanged);
+        indexScope(scope, scope->scopeId());
+    }
+
+    /**
+     * @brief Database::onChildScopeRemoved
+     * @param scope
+     */
+    void Database::onChildScopeRemoved(const Entity::SharedScope &scope)
+    {
+        indexScope(scope, scope->scopeId(), false /*add*/);
+    }
+
+    /**
+     * @brief Database::onChildScopeIdChanged
+     * @param scope
+     * @param oldID
+     */
+    void Database::onChildScopeIdChanged(const Entity::SharedScope &scope, const Common::ID &oldID)
+    {
+        rekeyScope(oldID, scope->id());
+    }
+
+    /**
+     * @brief Database::indexType
+     * @param type
+     */
+    void Database::indexType(const Entity::SharedType &type)
+    {
+        if (!type)
+            return;
+
+        m_TypesIndex[type->id()] = type;
+        if (!m_TypesNameIndex.contains(type->name(), type))
+            m_TypesNameIndex.insert(type->name(), type);
+    }
+
+    /**
+     * @brief Database::unindexType
+     * @param type
+     */
+    void Database::unindexType(const Entity::SharedType &type)
+    {
+        if (!type)
+            return;
+
+        if (m_TypesIndex.value(type->id()) == type)
+            m_TypesIndex.remove(type->id());
+        m_TypesNameIndex.remove(type->name(), type);
+    }
+
+    /**
+     * @brief Database::indexScope
+     * @param scope
+     * @param parentID
+     * @param add
+     */
+    void Database::indexScope(const Entity::SharedScope &scope, const Common::ID &parentID, bool add)
+    {
+        if (!scope)
+            return;
+
+        if (add)
+            m_ScopesIndex[scope->id()] = {scope, parentID};
+        else if (m_ScopesIndex.value(scope->id()).scope == scope)
+            m_ScopesIndex.remove(scope->id());
+
+        for (auto &&type : scope->types())
+            add ? indexType(type) : unindexType(type);
+
+        for (auto &&child : scope->scopes())
+            indexScope(child, scope->id(), add);
+    }
+
+    /**
+     * @brief Database::rekeyScope
+     * @param oldID
+     * @param newID
+     */
+    void Database::rekeyScope(const Common::ID &oldID, const Common::ID &newID)
+    {
+        if (m_Loader)
+            m_Loader->onScopeIDChanged(oldID, newID);
+
+        auto node = m_ScopesIndex.take(oldID);
+        if (!node.scope)
+            return;
+
+        m_ScopesIndex[newID] = node;
+
+        // Keep back-links of the nested scopes
+        for (auto &&child : node.scope->scopes())
+            if (auto it = m_ScopesIndex.find(child->id()); it != m_ScopesIndex.end())
+                it->parentID = newID;
+    }
+
+    /**
+     * @brief Database::rebuildIndex
+     */
+    void Database::rebuildIndex()
+    {
+        m_TypesIndex.clear();
+        m_TypesNameIndex.clear();
+        m_ScopesIndex.clear();
+
+        for (auto &&scope : m_Scopes)
+            indexScope(scope, scope->scopeId());
+    }
+
+    /**
+     * @brief Database::loadLazy
+     * @param loader
+     */
+    void Database::loadLazy(std::unique_ptr<LazyLoader> loader)
+    {
+        clear();
+
+        m_ID = loader->id();
+        for (auto &&record : loader->scopes())
+            addScopeRecord(record, nullptr);
+
+        m_Loader = std::move(loader);
+        releaseLoader();
+    }
+
+    /**
+     * @brief Database::addScopeRecord
+     * @param record
+     * @param parent
+     */
+    void Database::addScopeRecord(const LazyLoader::ScopeRecord &record,
+                                  const Entity::SharedScope &parent)
+    {
+        // Listeners of the scope added notifications should see the loaded name and ID
+        auto scope = std::make_shared<Entity::Scope>(record.name, record.parentID);
+        scope->setId(record.id);
+
+        if (parent)
+            parent->addExistsChildScope(scope);
         else
-            G_DISCONNECT(scope, &Common::BasicElement::idChanged, this, &Database::onScopeIDChanged);
+            addExistsScope(scope);
+
+        for (auto &&child : record.scopes)
+            addScopeRecord(child, scope);
+    }
+
+    /**
+     * @brief Database::materializeType
+     * @param typeID
+     * @return
+     */
+    Entity::SharedType Database::materializeType(const Common::ID &typeID) const
+    {
+        if (!m_Loader)
+            return nullptr;
+
+        // Lookups are not synchronized, see LoadMode
+        Q_ASSERT_X(QThread::currentThread() == thread(), Q_FUNC_INFO,
+                   "materialize() should be called before the database is read from other threads");
+
+        auto record = m_Loader->takeType(typeID);
+        if (!record)
+            return nullptr;
+
+        ErrorList errors;
+        auto object = m_Loader->typeObject(*record, errors);
+        auto scope = m_ScopesIndex.value(record->scopeID).scope;
+
+        // Will be indexed by the scope notification
+        Entity::SharedType type;
+        if (errors.isEmpty())
+            type = Entity::EntityFactory::instance().make(object, errors, scope);
+
+        if (!errors.isEmpty()) {
+            // Partially loaded type is not kept, the data is written back unchanged instead
+            if (type && scope)
+                scope->removeType(type->id());
+
+            if (!object.isEmpty())
+                m_UnloadedTypes[record->scopeID.toJson().toString()] << object;
+
+            m_Errors << tr("Cannot load type %1: %2").arg(record->name, errors.join(" "));
+            return nullptr;
+        }
+
+        return type;
+    }
+
+    /**
+     * @brief Database::materializeScope
+     * @param scopeID
+     */
+    void Database::materializeScope(const Common::ID &scopeID) const
+    {
+        if (!m_Loader)
+            return;
+
+        for (auto &&id : m_Loader->pendingTypes(scopeID))
+            materializeType(id);
+
+        releaseLoader();
+    }
+
+    /**
+     * @brief Database::releaseLoader
+     */
+    void Database::releaseLoader() const
+    {
+        if (m_Loader && m_Loader->isEmpty())
+            m_Loader.reset();
     }
 
 } // namespace db
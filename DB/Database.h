@@ -23,6 +23,8 @@
 #pragma once
 
 #include <QHash>
+#include <QVector>
+#include <QJsonObject>
 
 #include <Entity/EntityTypes.hpp>
 
@@ -31,6 +33,7 @@
 
 #include "ITypeSearcher.h"
 #include "IScopeSearcher.h"
+#include "LazyLoader.h"
 #include "types.h"
 #include "DBTypes.hpp"
 
@@ -51,6 +54,13 @@ namespace DB {
         Q_OBJECT
 
     public:
+        /// Lazy mode builds only scopes on loading, types are created on the first access.
+        /// Creation is not synchronized, so materialize() should be called on the owner thread
+        /// before the database is read from other threads
+        enum class LoadMode { Eager, Lazy };
+        /// On-disk representation, loading detects it by the file signature
+        enum class Format { Json, Binary };
+
         Database(Database &&src) noexcept;
         Database(const Database &src);
         Database(const QString &name = "", const QString &path = "");
@@ -81,6 +91,13 @@ namespace DB {
         bool save() const;
         virtual void clear();
 
+        LoadMode loadMode() const;
+        void setLoadMode(LoadMode mode);
+        void materialize() const;
+
+        Format format() const;
+        void setFormat(Format format);
+
         virtual QJsonObject toJson() const;
         virtual void fromJson(const QJsonObject &src, QStringList &errorList);
 
@@ -89,7 +106,13 @@ namespace DB {
         Common::ID id() const;
         void setId(const Common::ID &ID);
 
+        Common::ID parentScopeID(const Common::ID &scopeID) const;
+
         bool valid() const;
+        ErrorList lastErrors() const;
+
+        /// Data of types which cannot be created, by scope ID. Saved unchanged
+        using UnloadedTypes = QHash<QString, QVector<QJsonObject>>;
 
         static QString mkPath(const QString &path, const QString &name);
 
@@ -107,11 +130,24 @@ namespace DB {
     public slots:
         void onScopeIDChanged(const Common::ID &oldID, const Common::ID &newID);
 
+        void onTypeAdded(const Entity::SharedType &type);
+        void onTypeRemoved(const Entity::SharedType &type);
+        void onTypeRenamed(const Entity::SharedType &type, const QString &oldName);
+        void onTypeIdChanged(const Entity::SharedType &type, const Common::ID &oldID);
+        void onChildScopeAdded(const Entity::SharedScope &scope);
+        void onChildScopeRemoved(const Entity::SharedScope &scope);
+        void onChildScopeIdChanged(const Entity::SharedScope &scope, const Common::ID &oldID);
+
     signals:
         void loaded();
         void scopeAdded(const Entity::SharedScope &scope);
         void scopeRemoved(const Entity::SharedScope &scope);
 
+        // Forwarded from all scopes of the database
+        void typeRemoved(const Entity::SharedType &type);
+        void typeRenamed(const Entity::SharedType &type, const QString &oldName);
+        void typeIdChanged(const Entity::SharedType &type, const Common::ID &oldID);
+
     protected:
         Entity::SharedScope depthScopeSearch(const Common::ID &id) const;
         virtual void copyFrom(const Database &src);
@@ -121,15 +157,37 @@ namespace DB {
         QString    m_Path ;
         Common::ID m_ID   ;
         bool       m_Valid;
+        LoadMode   m_LoadMode;
+        Format     m_Format;
 
         Entity::Scopes m_Scopes;
 
     private:
-        using IDList = QList<Common::ID>;
-        IDList makeDepthIdList(const Common::ID &id) const;
-        Entity::SharedScope getScopeWithDepthList(const IDList &ids) const;
+        // Flat indexes over all nesting levels, kept in sync by the scopes notifications
+        using TypesNameIndex = QMultiHash<QString, Entity::SharedType>;
+        Entity::Types  m_TypesIndex;
+        TypesNameIndex m_TypesNameIndex;
+
+        struct ScopeNode { Entity::SharedScope scope; Common::ID parentID; };
+        QHash<Common::ID, ScopeNode> m_ScopesIndex;
+
+        void indexType(const Entity::SharedType &type);
+        void unindexType(const Entity::SharedType &type);
+        void indexScope(const Entity::SharedScope &scope, const Common::ID &parentID, bool add = true);
+        void rekeyScope(const Common::ID &oldID, const Common::ID &newID);
+        void rebuildIndex();
+
+        mutable std::unique_ptr<LazyLoader> m_Loader;
+        mutable UnloadedTypes m_UnloadedTypes;
+        mutable ErrorList m_Errors;
+
+        void loadLazy(std::unique_ptr<LazyLoader> loader);
+        void addScopeRecord(const LazyLoader::ScopeRecord &record, const Entity::SharedScope &parent);
+        Entity::SharedType materializeType(const Common::ID &typeID) const;
+        void materializeScope(const Common::ID &scopeID) const;
+        void releaseLoader() const;
+
         QString makeFullPath() const;
-        void recursiveFind(Entity::SharedScope scope, const Common::ID &id, IDList &ids) const;
 
         void connectScope(Entity::Scope *scope, bool connect = true);
     };
@@ -0,0 +1,631 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "LazyLoader.h"
+
+#include <QJsonDocument>
+
+#include <Common/StringPool.h>
+
+#include "BinaryFormat.h"
+
+namespace DB {
+
+    namespace {
+
+        const QString nameMark    = "Name";
+        const QString idMark      = "ID";
+        const QString scopeIdMark = "Scope ID";
+        const QString scopesMark  = "Scopes";
+        const QString typesMark   = "Types";
+
+        /// Minimal forward-only JSON reader. Keeps offsets and skips values without
+        /// building the document
+        class JsonScanner
+        {
+        public:
+            JsonScanner(const char *data, qint64 size)
+                : m_Data(data), m_Size(size), m_Pos(0)
+            {}
+
+            qint64 pos() { skipWs(); return m_Pos; }
+
+            bool consume(char c)
+            {
+                skipWs();
+                if (m_Pos < m_Size && m_Data[m_Pos] == c) {
+                    ++m_Pos;
+                    return true;
+                }
+
+                return false;
+            }
+
+            bool readString(QString &out)
+            {
+                if (!consume('"'))
+                    return false;
+
+                out.clear();
+                qint64 begin = m_Pos;
+                while (m_Pos < m_Size) {
+                    const char c = m_Data[m_Pos];
+                    if (c == '"') {
+                        out += QString::fromUtf8(m_Data + begin, int(m_Pos - begin));
+                        ++m_Pos;
+                        return true;
+                    }
+
+                    if (c == '\\') {
+                        out += QString::fromUtf8(m_Data + begin, int(m_Pos - begin));
+                        if (!readEscape(out))
+                            return false;
+
+                        begin = m_Pos;
+                        continue;
+                    }
+
+                    ++m_Pos;
+                }
+
+                return false;
+            }
+
+            bool readID(Common::ID &id)
+            {
+                QString value;
+                if (!readString(value))
+                    return false;
+
+                bool ok = false;
+                id = Common::ID(value.toULongLong(&ok));
+                return ok;
+            }
+
+            bool skipValue()
+            {
+                skipWs();
+                if (m_Pos >= m_Size)
+                    return false;
+
+                const char c = m_Data[m_Pos];
+                if (c == '"')
+                    return skipString();
+
+                if (c == '{' || c == '[') {
+                    int depth = 0;
+                    while (m_Pos < m_Size) {
+                        const char ch = m_Data[m_Pos];
+                        if (ch == '"') {
+                            if (!skipString())
+                                return false;
+                            continue;
+                        }
+
+                        ++m_Pos;
+                        if (ch == '{' || ch == '[')
+                            ++depth;
+                        else if ((ch == '}' || ch == ']') && --depth == 0)
+                            return true;
+                    }
+
+                    return false;
+                }
+
+                // Number or literal
+                const qint64 begin = m_Pos;
+                while (m_Pos < m_Size && !isDelimiter(m_Data[m_Pos]))
+                    ++m_Pos;
+
+                return m_Pos != begin;
+            }
+
+            /// Calls handler for each member key, handler must consume the value
+            template <class Handler>
+            bool forEachMember(Handler &&handler)
+            {
+                if (!consume('{'))
+                    return false;
+
+                if (consume('}'))
+                    return true;
+
+                do {
+                    QString key;
+                    if (!readString(key) || !consume(':') || !handler(key))
+                        return false;
+                } while (consume(','));
+
+                return consume('}');
+            }
+
+            /// Calls handler for each array element, handler must consume the element
+            template <class Handler>
+            bool forEachElement(Handler &&handler)
+            {
+                if (!consume('['))
+                    return false;
+
+                if (consume(']'))
+                    return true;
+
+                do {
+                    if (!handler())
+                        return false;
+                } while (consume(','));
+
+                return consume(']');
+            }
+
+        private:
+            static bool isDelimiter(char c)
+            {
+                return c == ',' || c == '}' || c == ']' ||
+                       c == ' ' || c == '\n' || c == '\r' || c == '\t';
+            }
+
+            void skipWs()
+            {
+                while (m_Pos < m_Size && (m_Data[m_Pos] == ' '  || m_Data[m_Pos] == '\n' ||
+                                          m_Data[m_Pos] == '\r' || m_Data[m_Pos] == '\t'))
+                    ++m_Pos;
+            }
+
+            bool skipString()
+            {
+                if (!consume('"'))
+                    return false;
+
+                while (m_Pos < m_Size) {
+                    const char c = m_Data[m_Pos++];
+                    if (c == '\\')
+                        ++m_Pos;
+                    else if (c == '"')
+                        return true;
+                }
+
+                return false;
+            }
+
+            bool readEscape(QString &out)
+            {
+                // Skip backslash
+                if (++m_Pos >= m_Size)
+                    return false;
+
+                switch (m_Data[m_Pos]) {
+                    case '"':  out += QChar('"');  break;
+                    case '\\': out += QChar('\\'); break;
+                    case '/':  out += QChar('/');  break;
+                    case 'b':  out += QChar('\b'); break;
+                    case 'f':  out += QChar('\f'); break;
+                    case 'n':  out += QChar('\n'); break;
+                    case 'r':  out += QChar('\r'); break;
+                    case 't':  out += QChar('\t'); break;
+                    case 'u': {
+                        if (m_Pos + 4 >= m_Size)
+                            return false;
+
+                        bool ok = false;
+                        const ushort code = QByteArray(m_Data + m_Pos + 1, 4).toUShort(&ok, 16);
+                        if (!ok)
+                            return false;
+
+                        out += QChar(code);
+                        m_Pos += 4;
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+
+                ++m_Pos;
+                return true;
+            }
+
+            const char *m_Data;
+            qint64 m_Size;
+            qint64 m_Pos;
+        };
+
+        /// The same interface as JsonScanner for the binary format
+        class BinaryScanner
+        {
+        public:
+            explicit BinaryScanner(Binary::Reader &reader)
+                : m_Reader(reader)
+            {}
+
+            qint64 pos() { return m_Reader.pos(); }
+
+            bool readString(QString &out) { return m_Reader.readString(out); }
+
+            bool readID(Common::ID &id)
+            {
+                QString value;
+                if (!readString(value))
+                    return false;
+
+                bool ok = false;
+                id = Common::ID(value.toULongLong(&ok));
+                return ok;
+            }
+
+            bool skipValue() { return m_Reader.skipValue(); }
+
+            template <class Handler>
+            bool forEachMember(Handler &&handler)
+            {
+                quint64 count = 0;
+                if (!m_Reader.beginObject(count))
+                    return false;
+
+                for (quint64 i = 0; i < count; ++i) {
+                    QString key;
+                    if (!m_Reader.readKey(key) || !handler(key))
+                        return false;
+                }
+
+                return true;
+            }
+
+            template <class Handler>
+            bool forEachElement(Handler &&handler)
+            {
+                quint64 count = 0;
+                if (!m_Reader.beginArray(count))
+                    return false;
+
+                for (quint64 i = 0; i < count; ++i)
+                    if (!handler())
+                        return false;
+
+                return true;
+            }
+
+        private:
+            Binary::Reader &m_Reader;
+        };
+
+        using TypeRecords = QVector<LazyLoader::TypeRecord>;
+
+        template <class Scanner>
+        bool scanType(Scanner &s, TypeRecords &types)
+        {
+            LazyLoader::TypeRecord record;
+            record.offset = s.pos();
+
+            bool ok = s.forEachMember([&](const QString &key) {
+                if (key == idMark)
+                    return s.readID(record.id);
+                else if (key == nameMark)
+                    return s.readString(record.name);
+                else
+                    return s.skipValue();
+            });
+
+            record.size = s.pos() - record.offset;
+            types << record;
+
+            return ok && record.id.isValid();
+        }
+
+        template <class Scanner>
+        bool scanScope(Scanner &s, LazyLoader::ScopeRecord &scope, TypeRecords &types)
+        {
+            TypeRecords scopeTypes;
+            bool ok = s.forEachMember([&](const QString &key) {
+                if (key == idMark)
+                    return s.readID(scope.id);
+                else if (key == nameMark)
+                    return s.readString(scope.name);
+                else if (key == scopeIdMark)
+                    return s.readID(scope.parentID);
+                else if (key == scopesMark)
+                    return s.forEachElement([&] {
+                        LazyLoader::ScopeRecord child;
+                        if (!scanScope(s, child, types))
+                            return false;
+
+                        scope.scopes << child;
+                        return true;
+                    });
+                else if (key == typesMark)
+                    return s.forEachElement([&] { return scanType(s, scopeTypes); });
+                else
+                    return s.skipValue();
+            });
+
+            // Scope ID can be placed after types
+            for (auto &&t : scopeTypes)
+                t.scopeID = scope.id;
+            types << scopeTypes;
+
+            return ok && scope.id.isValid();
+        }
+
+    } // namespace
+
+    /**
+     * @brief LazyLoader::LazyLoader
+     */
+    LazyLoader::LazyLoader()
+        : m_Map(nullptr)
+        , m_Size(0)
+    {
+    }
+
+    /**
+     * @brief LazyLoader::~LazyLoader
+     */
+    LazyLoader::~LazyLoader()
+    {
+        if (m_Map)
+            m_File.unmap(m_Map);
+    }
+
+    /**
+     * @brief LazyLoader::open
+     * @param fileName
+     * @return
+     */
+    bool LazyLoader::open(const QString &fileName)
+    {
+        m_File.setFileName(fileName);
+        if (!m_File.open(QIODevice::ReadOnly))
+            return false;
+
+        m_Size = m_File.size();
+        m_Map = m_Size > 0 ? m_File.map(0, m_Size) : nullptr;
+
+        // Fallback for the file systems which don't support mapping
+        if (!m_Map)
+            m_Buffer = m_File.readAll();
+
+        TypeRecords types;
+        bool ok = false;
+        if (Binary::isBinary(QByteArray::fromRawData(data(), int(qMin<qint64>(m_Size, 8))))) {
+            m_Reader = std::make_unique<Binary::Reader>(data(), m_Size);
+            BinaryScanner s(*m_Reader);
+            ok = m_Reader->readHeader() && scanDatabase(s, types);
+        } else {
+            JsonScanner s(data(), m_Size);
+            ok = scanDatabase(s, types);
+        }
+
+        if (!ok)
+            return false;
+
+        m_Types.reserve(types.size());
+        for (auto &&t : types) {
+            // The same data is used by the types after materialization
+            t.name = Common::intern(t.name);
+            m_Types[t.id] = t;
+            m_TypesByName.insert(t.name, t.id);
+            m_TypesByScope[t.scopeID] << t.id;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief LazyLoader::scanDatabase
+     * @param s
+     * @param types
+     * @return
+     */
+    template <class Scanner>
+    bool LazyLoader::scanDatabase(Scanner &s, QVector<TypeRecord> &types)
+    {
+        return s.forEachMember([&](const QString &key) {
+            if (key == idMark)
+                return s.readID(m_ID);
+            else if (key == nameMark)
+                return s.readString(m_Name);
+            else if (key == scopesMark)
+                return s.forEachElement([&] {
+                    ScopeRecord scope;
+                    if (!scanScope(s, scope, types))
+                        return false;
+
+                    m_Scopes << scope;
+                    return true;
+                });
+            else
+                return s.skipValue();
+        });
+    }
+
+    /**
+     * @brief LazyLoader::name
+     * @return
+     */
+    QString LazyLoader::name() const
+    {
+        return m_Name;
+    }
+
+    /**
+     * @brief LazyLoader::id
+     * @return
+     */
+    Common::ID LazyLoader::id() const
+    {
+        return m_ID;
+    }
+
+    /**
+     * @brief LazyLoader::scopes
+     * @return
+     */
+    QVector<LazyLoader::ScopeRecord> LazyLoader::scopes() const
+    {
+        return m_Scopes;
+    }
+
+    /**
+     * @brief LazyLoader::isBinary
+     * @return
+     */
+    bool LazyLoader::isBinary() const
+    {
+        return !!m_Reader;
+    }
+
+    /**
+     * @brief LazyLoader::isEmpty
+     * @return
+     */
+    bool LazyLoader::isEmpty() const
+    {
+        return m_Types.isEmpty();
+    }
+
+    /**
+     * @brief LazyLoader::contains
+     * @param typeID
+     * @return
+     */
+    bool LazyLoader::contains(const Common::ID &typeID) const
+    {
+        return m_Types.contains(typeID);
+    }
+
+    /**
+     * @brief LazyLoader::findType
+     * @param name
+     * @return
+     */
+    std::optional<Common::ID> LazyLoader::findType(const QString &name) const
+    {
+        auto it = m_TypesByName.find(name);
+        if (it == m_TypesByName.end())
+            return std::nullopt;
+
+        return *it;
+    }
+
+    /**
+     * @brief LazyLoader::pendingTypes
+     * @return
+     */
+    QVector<Common::ID> LazyLoader::pendingTypes() const
+    {
+        return m_Types.keys().toVector();
+    }
+
+    /**
+     * @brief LazyLoader::pendingTypes
+     * @param scopeID
+     * @return
+     */
+    QVector<Common::ID> LazyLoader::pendingTypes(const Common::ID &scopeID) const
+    {
+        return m_TypesByScope.value(scopeID);
+    }
+
+    /**
+     * @brief LazyLoader::takeType
+     * @param typeID
+     * @return
+     */
+    std::optional<LazyLoader::TypeRecord> LazyLoader::takeType(const Common::ID &typeID)
+    {
+        auto it = m_Types.find(typeID);
+        if (it == m_Types.end())
+            return std::nullopt;
+
+        TypeRecord record = *it;
+        m_Types.erase(it);
+        m_TypesByName.remove(record.name, record.id);
+
+        auto &scopeTypes = m_TypesByScope[record.scopeID];
+        scopeTypes.removeOne(record.id);
+        if (scopeTypes.isEmpty())
+            m_TypesByScope.remove(record.scopeID);
+
+        return record;
+    }
+
+    /**
+     * @brief LazyLoader::typeObject
+     * @param record
+     * @param errors
+     * @return
+     */
+    QJsonObject LazyLoader::typeObject(const TypeRecord &record, ErrorList &errors) const
+    {
+        if (record.offset < 0 || record.offset + record.size > m_Size) {
+            errors << QObject::tr("Wrong type record: %1.").arg(record.name);
+            return QJsonObject();
+        }
+
+        if (m_Reader) {
+            // Copy shares the strings table and keeps the loader untouched
+            Binary::Reader reader(*m_Reader);
+            QJsonValue value;
+            if (!reader.seek(record.offset) || !reader.readValue(value) || !value.isObject()) {
+                errors << reader.errors() << QObject::tr("Wrong type record: %1.").arg(record.name);
+                return QJsonObject();
+            }
+
+            return value.toObject();
+        }
+
+        QJsonParseError error;
+        auto doc = QJsonDocument::fromJson(
+                       QByteArray::fromRawData(data() + record.offset, int(record.size)), &error);
+        if (error.error != QJsonParseError::NoError) {
+            errors << error.errorString();
+            return QJsonObject();
+        }
+
+        return doc.object();
+    }
+
+    /**
+     * @brief LazyLoader::onScopeIDChanged
+     * @param oldID
+     * @param newID
+     */
+    void LazyLoader::onScopeIDChanged(const Common::ID &oldID, const Common::ID &newID)
+    {
+        auto ids = m_TypesByScope.take(oldID);
+        if (ids.isEmpty())
+            return;
+
+        for (auto &&id : ids)
+            m_Types[id].scopeID = newID;
+
+        m_TypesByScope[newID] = ids;
+    }
+
+    /**
+     * @brief LazyLoader::data
+     * @return
+     */
+    const char *LazyLoader::data() const
+    {
+        return m_Map ? reinterpret_cast<const char *>(m_Map) : m_Buffer.constData();
+    }
+
+} // namespace DB
@@ -0,0 +1,106 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include <QFile>
+#include <QHash>
+#include <QVector>
+#include <QJsonObject>
+
+#include <Common/ID.h>
+
+#include "types.h"
+
+namespace DB {
+
+    namespace Binary { class Reader; }
+
+    /// Memory maps a database file and builds an offset index of its scopes and types.
+    /// Types are parsed only on request. Both JSON and binary files are supported.
+    class LazyLoader
+    {
+    public:
+        struct TypeRecord
+        {
+            Common::ID id;
+            Common::ID scopeID;
+            QString name;
+            qint64 offset = 0;
+            qint64 size = 0;
+        };
+
+        struct ScopeRecord
+        {
+            Common::ID id;
+            Common::ID parentID;
+            QString name;
+            QVector<ScopeRecord> scopes;
+        };
+
+        LazyLoader();
+        ~LazyLoader();
+
+        bool open(const QString &fileName);
+
+        QString name() const;
+        Common::ID id() const;
+        QVector<ScopeRecord> scopes() const;
+
+        bool isBinary() const;
+        bool isEmpty() const;
+        bool contains(const Common::ID &typeID) const;
+        std::optional<Common::ID> findType(const QString &name) const;
+
+        QVector<Common::ID> pendingTypes() const;
+        QVector<Common::ID> pendingTypes(const Common::ID &scopeID) const;
+        std::optional<TypeRecord> takeType(const Common::ID &typeID);
+
+        QJsonObject typeObject(const TypeRecord &record, ErrorList &errors) const;
+
+        void onScopeIDChanged(const Common::ID &oldID, const Common::ID &newID);
+
+    private:
+        const char *data() const;
+
+        template <class Scanner>
+        bool scanDatabase(Scanner &s, QVector<TypeRecord> &types);
+
+        QFile m_File;
+        uchar *m_Map;
+        QByteArray m_Buffer;
+        qint64 m_Size;
+        std::unique_ptr<Binary::Reader> m_Reader;
+
+        QString m_Name;
+        Common::ID m_ID;
+        QVector<ScopeRecord> m_Scopes;
+
+        QHash<Common::ID, TypeRecord> m_Types;
+        QMultiHash<QString, Common::ID> m_TypesByName;
+        QHash<Common::ID, QVector<Common::ID>> m_TypesByScope;
+    };
+
+} // namespace DB
@@ -73,6 +73,8 @@ namespace DB {
     ProjectDatabase::ProjectDatabase(const QString &name, const QString &path)
         : Database(name, path)
     {
+        // Project types are shown in the tree model and on the scene right after loading
+        setLoadMode(LoadMode::Eager);
     }
 
     /**
@@ -346,6 +348,34 @@ namespace DB {
         return *this == rhs;
     }
 
+    /**
+     * @brief ProjectDatabase::beginBulkLoad
+     */
+    void ProjectDatabase::beginBulkLoad()
+    {
+        if (m_BulkLoadDepth++ == 0)
+            emit bulkLoadStarted();
+    }
+
+    /**
+     * @brief ProjectDatabase::endBulkLoad
+     */
+    void ProjectDatabase::endBulkLoad()
+    {
+        Q_ASSERT(m_BulkLoadDepth > 0);
+        if (--m_BulkLoadDepth == 0)
+            emit bulkLoadFinished();
+    }
+
+    /**
+     * @brief ProjectDatabase::isBulkLoading
+     * @return
+     */
+    bool ProjectDatabase::isBulkLoading() const
+    {
+        return m_BulkLoadDepth > 0;
+    }
+
     /**
      * @brief ProjectDatabase::onTypeUserAdded
      * @param tu
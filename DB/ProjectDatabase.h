@@ -79,10 +79,18 @@ namespace DB {
 
         bool isEqual(const ProjectDatabase &rhs) const;
 
+        void beginBulkLoad();
+        void endBulkLoad();
+        bool isBulkLoading() const;
+
     signals:
         void relationAdded();
         void relationRemoved();
 
+        // Emitted around the outermost bulk load, e.g. loading from the file
+        void bulkLoadStarted();
+        void bulkLoadFinished();
+
         // FIXME: also handle changing ID for graphic items
         void graphicsEntityRegistred(const Graphics::EntityPtr &);
         void graphicsEntityUnregistred(const Graphics::EntityPtr &);
@@ -111,6 +119,8 @@ namespace DB {
         Graphics::RelationHashMap m_GraphicsRelations;
         bool m_ClearGraphics = false;
 
+        int m_BulkLoadDepth = 0;
+
         DB::SharedDatabase m_GlobalDatabase;
     };
 
@@ -711,7 +711,9 @@ namespace Entity
             if (src["Methods"].isArray()) {
                 SharedMethod method;
                 QJsonObject obj;
-                for (auto &&value : src["Methods"].toArray()) {
+                const QJsonArray methods = src["Methods"].toArray();
+                m_Methods.reserve(m_Methods.size() + methods.size());
+                for (auto &&value : methods) {
                     obj = value.toObject();
                     Util::checkAndSet(obj, "Type", errorList,
                                          [&obj, &errorList, &method, this](){
@@ -729,7 +731,9 @@ namespace Entity
         Util::checkAndSet(src, "Fields", errorList, [&src, &errorList, this](){
             if (src["Fields"].isArray()) {
                 SharedField field;
-                for (auto &&value : src["Fields"].toArray()) {
+                const QJsonArray fields = src["Fields"].toArray();
+                m_Fields.reserve(m_Fields.size() + fields.size());
+                for (auto &&value : fields) {
                     field = std::make_shared<Field>();
                     field->fromJson(value.toObject(), errorList);
                     m_Fields << field;
@@ -42,6 +42,7 @@ namespace Entity {
 
     // TODO: add empty string between methods and fields
     // TODO: add insert comment posibility
+    // TODO: add optional compact storage for components (plain structs in per-class arrays)
 
     /**
      * @brief The Class class
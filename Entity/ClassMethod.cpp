@@ -23,6 +23,8 @@
 
 #include "ClassMethod.h"
 
+#include <tuple>
+
 #include <QStringList>
 #include <QJsonObject>
 #include <QJsonArray>
@@ -30,6 +32,7 @@
 #include <range/v3/algorithm/find_if.hpp>
 
 #include <Utility/helpfunctions.h>
+#include "QtHelpers.h"
 
 #include "ExtendedType.h"
 #include "field.h"
@@ -127,8 +130,13 @@ namespace Entity {
     ClassMethod &ClassMethod::operator =(const ClassMethod &rhs)
     {
         if (this != &rhs) {
+            const bool isChanged = !(*this == rhs);
+
             static_cast<BasicElement*>(this)->operator =(rhs);
             copyFrom(rhs);
+
+            if (isChanged)
+                emit changed();
         }
 
         return *this;
@@ -170,7 +178,11 @@ namespace Entity {
      */
     void ClassMethod::setSection(Section section)
     {
+        if (m_Section == section)
+            return;
+
         m_Section = section;
+        emit changed();
     }
 
     /**
@@ -188,7 +200,11 @@ namespace Entity {
      */
     void ClassMethod::setConstStatus(bool newStatus)
     {
+        if (m_ConstStatus == newStatus)
+            return;
+
         m_ConstStatus = newStatus;
+        emit changed();
     }
 
     /**
@@ -206,12 +222,17 @@ namespace Entity {
      */
     void ClassMethod::setIsSignal(bool signalStatus)
     {
+        const auto oldState = std::make_tuple(m_Section, m_SignalStatus, m_SlotStatus);
+
         m_SignalStatus = signalStatus;
         if (m_SignalStatus) {
             m_Section = Section::None;
             m_SlotStatus = false;
         } else
             m_Section = Section::Public;
+
+        if (oldState != std::make_tuple(m_Section, m_SignalStatus, m_SlotStatus))
+            emit changed();
     }
 
     /**
@@ -229,12 +250,17 @@ namespace Entity {
      */
     void ClassMethod::setIsSlot(bool slotStatus)
     {
+        const auto oldState = std::make_tuple(m_Section, m_SignalStatus, m_SlotStatus);
+
         m_SlotStatus = slotStatus;
         if (m_SlotStatus)
             m_SignalStatus = false;
 
         if (m_Section == Section::None && !isSignal())
             m_Section = Section::Public;
+
+        if (oldState != std::make_tuple(m_Section, m_SignalStatus, m_SlotStatus))
+            emit changed();
     }
 
     /**
@@ -252,7 +278,11 @@ namespace Entity {
      */
     void ClassMethod::setRhsIdentificator(RhsIdentificator identificator)
     {
+        if (m_RhsIdentificator == identificator)
+            return;
+
         m_RhsIdentificator = identificator;
+        emit changed();
     }
 
     /**
@@ -270,7 +300,11 @@ namespace Entity {
      */
     void ClassMethod::addLhsIdentificator(LhsIdentificator identificator)
     {
+        if (m_LhsIdentificators.contains(identificator))
+            return;
+
         m_LhsIdentificators << identificator;
+        emit changed();
     }
 
     /**
@@ -298,7 +332,8 @@ namespace Entity {
      */
     void ClassMethod::removeLhsIdentificator(LhsIdentificator identificator)
     {
-        m_LhsIdentificators.remove(identificator);
+        if (m_LhsIdentificators.remove(identificator))
+            emit changed();
     }
 
     /**
@@ -328,7 +363,9 @@ namespace Entity {
         }
 
         auto f = std::make_shared<Field>(name, typeId);
+        watchParameter(f);
         m_Parameters << f;
+        emit changed();
 
         return f;
     }
@@ -359,8 +396,11 @@ namespace Entity {
     void ClassMethod::removeParameter(const QString &name)
     {
         auto parameter = getParameter(name);
-        if (parameter)
+        if (parameter) {
+            parameter->disconnect(this);
             m_Parameters.remove(m_Parameters.indexOf(parameter));
+            emit changed();
+        }
     }
 
     /**
@@ -432,13 +472,18 @@ namespace Entity {
             m_RhsIdentificator = static_cast<RhsIdentificator>(src[rhsiMark].toInt());
         });
 
+        for (auto &&parameter : m_Parameters)
+            parameter->disconnect(this);
         m_Parameters.clear();
         Util::checkAndSet(src, paramsMark, errorList, [&src, &errorList, this](){
             if (src[paramsMark].isArray()) {
                 SharedField parameter;
-                for (auto &&value : src[paramsMark].toArray()) {
+                const QJsonArray parameters = src[paramsMark].toArray();
+                m_Parameters.reserve(m_Parameters.size() + parameters.size());
+                for (auto &&value : parameters) {
                     parameter = std::make_shared<Field>();
                     parameter->fromJson(value.toObject(), errorList);
+                    watchParameter(parameter);
                     m_Parameters << parameter;
                 }
             } else {
@@ -490,7 +535,13 @@ namespace Entity {
         m_SignalStatus = std::move(src.m_SignalStatus);
         m_ReturnTypeId = std::move(src.m_ReturnTypeId);
 
+        for (auto &&parameter : m_Parameters)
+            parameter->disconnect(this);
         m_Parameters = std::move(src.m_Parameters);
+        for (auto &&parameter : m_Parameters) {
+            parameter->disconnect(&src);
+            watchParameter(parameter);
+        }
 
         m_RhsIdentificator  = std::move(src.m_RhsIdentificator );
         m_LhsIdentificators = std::move(src.m_LhsIdentificators);
@@ -510,7 +561,11 @@ namespace Entity {
         m_SignalStatus = src.m_SignalStatus;
         m_ReturnTypeId = src.m_ReturnTypeId;
 
+        for (auto &&parameter : m_Parameters)
+            parameter->disconnect(this);
         Util::deepCopySharedPointerList(src.m_Parameters, m_Parameters);
+        for (auto &&parameter : m_Parameters)
+            watchParameter(parameter);
 
         m_RhsIdentificator  = src.m_RhsIdentificator;
         m_LhsIdentificators = src.m_LhsIdentificators;
@@ -531,7 +586,21 @@ namespace Entity {
      */
     void ClassMethod::setReturnTypeId(const Common::ID &returnTypeId)
     {
+        if (m_ReturnTypeId == returnTypeId)
+            return;
+
         m_ReturnTypeId = returnTypeId;
+        emit changed();
+    }
+
+    /**
+     * @brief ClassMethod::watchParameter
+     * @param parameter
+     */
+    void ClassMethod::watchParameter(const SharedField &parameter)
+    {
+        // Parameters are a part of the method signature
+        G_CONNECT(parameter.get(), &Common::BasicElement::changed, this, &Common::BasicElement::changed);
     }
 
 } // namespace entity
@@ -116,6 +116,8 @@ namespace Entity {
         ClassMethodType m_Type;
 
     private:
+        void watchParameter(const SharedField &parameter);
+
         Section m_Section;
         bool    m_ConstStatus;
         bool    m_SlotStatus;
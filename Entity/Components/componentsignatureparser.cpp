@@ -123,6 +123,62 @@ namespace Components {
             {Models::DisplayPart::Properties, propertyPattern},
         };
 
+        // Patterns are compiled once and shared by all parsers
+        QRegularExpression makeRegex(const QString &pattern)
+        {
+            QRegularExpression re(pattern);
+            if (re.isValid())
+                re.optimize();
+            else
+                qWarning() << "In:" << Q_FUNC_INFO << "-- regexp is not valid:" << re.errorString()
+                           << "at:" << re.patternErrorOffset();
+
+            return re;
+        }
+
+        const QRegularExpression &typeRegex()
+        {
+            static const QRegularExpression re = makeRegex(type);
+            return re;
+        }
+
+        const QRegularExpression &argumentRegex()
+        {
+            static const QRegularExpression re = makeRegex(argumentPattern);
+            return re;
+        }
+
+        const QRegularExpression *componentRegex(Models::DisplayPart display)
+        {
+            static const QMap<Models::DisplayPart, QRegularExpression> regexMap = [] {
+                QMap<Models::DisplayPart, QRegularExpression> result;
+                for (auto it = componentPatternMap.begin(); it != componentPatternMap.end(); ++it)
+                    result.insert(it.key(), makeRegex(it.value()));
+                return result;
+            }();
+
+            auto it = regexMap.find(display);
+            return it != regexMap.end() && it->isValid() ? &*it : nullptr;
+        }
+
+        // Words are separated by "::" (and by "," if required); no temporary sets are built
+        bool containsKeyword(const QString &s, const Keywords &keywords, bool splitByComma)
+        {
+            for (auto &&part : s.splitRef("::", QString::SkipEmptyParts)) {
+                if (!splitByComma) {
+                    if (keywords.contains(part.toString()))
+                        return true;
+                    continue;
+                }
+
+                for (auto &&word : part.split(',', QString::SkipEmptyParts))
+                    if (keywords.contains(word.toString()))
+                        return true;
+            }
+
+            return false;
+        }
+
         const QMap<Models::DisplayPart, int> componentsGroupCount =
         {
             {Models::DisplayPart::Fields, int(FieldGroupNames::GroupsCount)},
@@ -134,7 +190,7 @@ namespace Components {
         using NumberKeywords = std::pair<int, Keywords>;
         using Forbidden = QVector<NumberKeywords>;
 
-        QMap<Models::DisplayPart, Forbidden> forbiddenMap = {
+        const QMap<Models::DisplayPart, Forbidden> forbiddenMap = {
             {Models::DisplayPart::Fields,
             {
                 {int(FieldGroupNames::Namespaces), reservedKeywords|types|boolKeywords},
@@ -173,8 +229,7 @@ namespace Components {
 
         bool parseType(const QString &s, Tokens &tokens)
         {
-            const QRegularExpression re(type);
-            auto match = re.match(s.trimmed());
+            auto match = typeRegex().match(s.trimmed());
             if (match.hasMatch()) {
                 tokens.resize(int(TypeGroups::GroupsCount));
                 for (int i = 1; i < int(TypeGroups::GroupsCount); ++i)
@@ -182,13 +237,11 @@ namespace Components {
                     const QString &cap = match.captured(i).trimmed();
                     tokens[i] = std::make_shared<Token>(cap);
 
-                    const Keywords &forbidden = forbiddenForTypes.value(i);
-                    if (!forbidden.isEmpty()) {
-                        if (!(tokens[i]->token().split("::", QString::SkipEmptyParts)
-                              .toSet() & forbidden).isEmpty()) {
-                            tokens.clear();
-                            return false;
-                        }
+                    auto forbidden = forbiddenForTypes.find(i);
+                    if (forbidden != forbiddenForTypes.end() &&
+                        containsKeyword(tokens[i]->token(), *forbidden, false /*splitByComma*/)) {
+                        tokens.clear();
+                        return false;
                     }
                 }
             }
@@ -200,7 +253,7 @@ namespace Components {
         using GroupRules = QPair<int, RulesFunc>;
         using GroupRulesVector = QVector<GroupRules>;
         using RulesMap = QMap<Models::DisplayPart, GroupRulesVector>;
-        RulesMap rulesMap =
+        const RulesMap rulesMap =
         {
             {Models::DisplayPart::Methods,
                 {
@@ -234,8 +287,7 @@ namespace Components {
                         Tokens tmpOut;
                         tmpOut.reserve(arguments.count());
                         for (auto &&arg : arguments) {
-                            const QRegularExpression re(argumentPattern);
-                            auto match = re.match(arg.trimmed());
+                            auto match = argumentRegex().match(arg.trimmed());
 
                             if (match.hasMatch()) {
                                Tokens argTokens(int(Argument::GroupsCount));
@@ -274,15 +326,16 @@ namespace Components {
             const int groupsCount = int(componentsGroupCount[display]);
             out.resize(groupsCount);
 
+            const Forbidden &forbidden = forbiddenMap[display];
+            const GroupRulesVector &rules = rulesMap[display];
+
             for (int groupIndex = 1; groupIndex < groupsCount; ++groupIndex)
             {
                 QString cap = match.captured(groupIndex).trimmed();
                 out[groupIndex] = std::make_shared<Token>(cap);
 
-                const Forbidden &forbidden = forbiddenMap[display];
                 auto fIt = ranges::find_if(forbidden, [&](auto &&c){ return c.first == groupIndex; });
 
-                const GroupRulesVector &rules = rulesMap[display];
                 auto rIt = ranges::find_if(rules, [&](auto &&r){ return r.first == groupIndex; });
 
                 // Check extra rules
@@ -296,10 +349,7 @@ namespace Components {
 
                 // Check forbidden words. Do not check forbidden words if there are some custom rules.
                 if (fIt != cend(forbidden) && rIt == cend(rules)) {
-                    const QStringList &tmpList =
-                        cap.remove(QChar::Space).split(QRegExp("::|,"), QString::SkipEmptyParts);
-
-                    if (!(tmpList.toSet() & fIt->second).isEmpty()) {
+                    if (containsKeyword(cap.remove(QChar::Space), fIt->second, true /*splitByComma*/)) {
                         out.clear();
                         return false;
                     }
@@ -320,19 +370,13 @@ namespace Components {
     {
         m_Tokens.clear();
 
-        const auto &pattern = componentPatternMap[display];
-        if (pattern.isEmpty())
+        const auto re = componentRegex(display);
+        if (!re)
             return false;
 
-        const QRegularExpression re(pattern);
-        if (re.isValid()) {
-            const auto &match = re.match(signature.trimmed());
-            if (match.hasMatch())
-                return split(match, display, m_Tokens);
-        } else {
-            qWarning() << "In:" << Q_FUNC_INFO << "-- regexp is not valid:" << re.errorString()
-                       << "at:" << re.patternErrorOffset();
-        }
+        const auto &match = re->match(signature.trimmed());
+        if (match.hasMatch())
+            return split(match, display, m_Tokens);
 
         return false;
     }
@@ -0,0 +1,779 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "declarationsimporter.h"
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QRegularExpression>
+#include <QTextStream>
+
+#include <DB/IScopeSearcher.h>
+#include <DB/ITypeSearcher.h>
+
+#include <Entity/Class.h>
+#include <Entity/ClassMethod.h>
+#include <Entity/ExtendedType.h>
+#include <Entity/field.h>
+#include <Entity/Scope.h>
+
+#include <Models/ComponentsModel.h>
+
+#include <enums.h>
+
+#include "componentscommon.h"
+#include "componentsignatureparser.h"
+#include "token.h"
+
+namespace Components {
+
+    namespace {
+
+        QRegularExpression makeRegex(const QString &pattern)
+        {
+            QRegularExpression re(pattern);
+            Q_ASSERT(re.isValid());
+            re.optimize();
+
+            return re;
+        }
+
+        const QRegularExpression &classHeaderRegex()
+        {
+            static const QRegularExpression re = makeRegex(
+                "^(class|struct)\\s+(?:\\w+\\s+)*?(\\w+)\\s*(?:final)?\\s*(?::.*)?$");
+            return re;
+        }
+
+        const QRegularExpression &namespaceRegex()
+        {
+            static const QRegularExpression re = makeRegex("^(?:inline\\s+)?namespace\\b");
+            return re;
+        }
+
+        const QRegularExpression &accessRegex()
+        {
+            static const QRegularExpression re = makeRegex(
+                "^(?:(public|protected|private)(\\s+(?:slots|Q_SLOTS))?|(signals|Q_SIGNALS))$");
+            return re;
+        }
+
+        // Declarations which are not class components
+        const QRegularExpression &skippedRegex()
+        {
+            static const QRegularExpression re = makeRegex(
+                "(?:^(?:using|typedef|friend|template|enum|union|class|struct|static_assert|"
+                "namespace|extern)\\b)|\\boperator\\b");
+            return re;
+        }
+
+        // Qt macros without semicolons, e.g. Q_OBJECT or Q_PROPERTY(...)
+        const QRegularExpression &qtMacroRegex()
+        {
+            static const QRegularExpression re = makeRegex(
+                "\\bQ_(?:OBJECT|GADGET|INVOKABLE|DECL_OVERRIDE|DECL_FINAL)\\b|\\bQ_[A-Z_]+\\s*\\([^)]*\\)");
+            return re;
+        }
+
+        // Specifiers which are not supported by the signature parser
+        const QRegularExpression &ignoredSpecifiersRegex()
+        {
+            static const QRegularExpression re = makeRegex(
+                "\\bnoexcept\\b(?:\\s*\\([^)]*\\))?|\\bconstexpr\\b");
+            return re;
+        }
+
+        // Signature parser expects a space between "*&" and a name, e.g. "QString &name"
+        const QRegularExpression &plcRegex()
+        {
+            static const QRegularExpression re = makeRegex("([\\*&]+)(?=\\w)");
+            return re;
+        }
+
+        const QRegularExpression &defaultArgumentRegex()
+        {
+            static const QRegularExpression re = makeRegex("\\s*=\\s*[^,()]*(?=[,)])");
+            return re;
+        }
+
+        const QRegularExpression &rhsAssignmentRegex()
+        {
+            static const QRegularExpression re = makeRegex("\\s*=\\s*(0|default|delete)\\s*$");
+            return re;
+        }
+
+        const QHash<QString, Entity::LhsIdentificator> lhsIdentificators = {
+            {"explicit", Entity::LhsIdentificator::Explicit    },
+            {"inline"  , Entity::LhsIdentificator::Inline      },
+            {"static"  , Entity::LhsIdentificator::MethodStatic},
+            {"virtual" , Entity::LhsIdentificator::Virtual     },
+            {"friend"  , Entity::LhsIdentificator::Friend      },
+        };
+
+        const QHash<QString, Entity::RhsIdentificator> rhsIdentificators = {
+            {"override" , Entity::RhsIdentificator::Override   },
+            {"final"    , Entity::RhsIdentificator::Final      },
+            {"= delete" , Entity::RhsIdentificator::Delete     },
+            {"= default", Entity::RhsIdentificator::Default    },
+            {"= 0"      , Entity::RhsIdentificator::PureVirtual},
+        };
+
+        const QHash<QString, Entity::FieldKeyword> fieldKeywords = {
+            {"volatile", Entity::Volatile   },
+            {"mutable" , Entity::Mutable    },
+            {"static"  , Entity::FieldStatic},
+        };
+
+        QString text(const SharedToken &token)
+        {
+            return token && token->isSingle() ? token->token() : QString();
+        }
+
+        QString stripComments(const QString &line, bool &inComment)
+        {
+            QString result;
+            result.reserve(line.size());
+
+            for (int i = 0, size = line.size(); i < size; ++i) {
+                const bool hasNext = i + 1 < size;
+
+                if (inComment) {
+                    if (line[i] == '*' && hasNext && line[i + 1] == '/') {
+                        inComment = false;
+                        ++i;
+                    }
+                    continue;
+                }
+
+                if (line[i] == '/' && hasNext) {
+                    if (line[i + 1] == '/')
+                        break;
+
+                    if (line[i + 1] == '*') {
+                        inComment = true;
+                        ++i;
+                        continue;
+                    }
+                }
+
+                result += line[i];
+            }
+
+            return result;
+        }
+
+        QString normalizedTemplateArgs(const QString &args)
+        {
+            QStringList result;
+            for (auto &&arg : args.splitRef(',', QString::SkipEmptyParts))
+                result << arg.trimmed().toString();
+
+            return result.join(", ");
+        }
+
+        bool hasSameModifiers(const Entity::ExtendedType &lhs, const Entity::ExtendedType &rhs)
+        {
+            return lhs.isConst()            == rhs.isConst()            &&
+                   lhs.useAlias()           == rhs.useAlias()           &&
+                   lhs.pl()                 == rhs.pl()                 &&
+                   lhs.templateParameters() == rhs.templateParameters();
+        }
+    }
+
+    /**
+     * @brief DeclarationsImporter::Statistics::linesPerSecond
+     * @return
+     */
+    double DeclarationsImporter::Statistics::linesPerSecond() const
+    {
+        return lines * 1000. / qMax(elapsed, qint64(1));
+    }
+
+    /**
+     * @brief DeclarationsImporter::DeclarationsImporter
+     * @param searchers
+     * @param scopeId
+     */
+    DeclarationsImporter::DeclarationsImporter(DB::SharedTypeSearchers searchers,
+                                               const Common::ID &scopeId)
+        : m_Searchers(std::move(searchers))
+        , m_ScopeId(scopeId)
+        , m_Parser(std::make_unique<ComponentSignatureParser>())
+        , m_TargetFrame{Context::Class, nullptr, Entity::Public, false, false}
+    {
+    }
+
+    /**
+     * @brief DeclarationsImporter::~DeclarationsImporter
+     */
+    DeclarationsImporter::~DeclarationsImporter()
+    {
+    }
+
+    /**
+     * @brief DeclarationsImporter::setTargetClass
+     * @param target
+     */
+    void DeclarationsImporter::setTargetClass(const Entity::SharedClass &target)
+    {
+        m_Target = target;
+        m_TargetFrame.cls = target;
+    }
+
+    /**
+     * @brief DeclarationsImporter::targetClass
+     * @return
+     */
+    Entity::SharedClass DeclarationsImporter::targetClass() const
+    {
+        return m_Target;
+    }
+
+    /**
+     * @brief DeclarationsImporter::import
+     * @param stream
+     * @return
+     */
+    bool DeclarationsImporter::import(QTextStream &stream)
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        reset();
+
+        QString line;
+        while (stream.readLineInto(&line))
+            processLine(line);
+
+        resolveTypes();
+
+        m_Statistics.elapsed = timer.elapsed();
+
+        return m_Statistics.errors == 0;
+    }
+
+    /**
+     * @brief DeclarationsImporter::import
+     * @param text
+     * @return
+     */
+    bool DeclarationsImporter::import(const QString &text)
+    {
+        QString tmp(text);
+        QTextStream stream(&tmp, QIODevice::ReadOnly);
+
+        return import(stream);
+    }
+
+    /**
+     * @brief DeclarationsImporter::types
+     * @return new classes, types for unknown names and type aliases, in order of addition
+     */
+    Entity::TypesList DeclarationsImporter::types() const
+    {
+        return m_Types;
+    }
+
+    /**
+     * @brief DeclarationsImporter::targetMethods
+     * @return
+     */
+    Entity::MethodsList DeclarationsImporter::targetMethods() const
+    {
+        return m_TargetMethods;
+    }
+
+    /**
+     * @brief DeclarationsImporter::targetFields
+     * @return
+     */
+    Entity::FieldsList DeclarationsImporter::targetFields() const
+    {
+        return m_TargetFields;
+    }
+
+    /**
+     * @brief DeclarationsImporter::errors
+     * @return
+     */
+    QStringList DeclarationsImporter::errors() const
+    {
+        return m_Errors;
+    }
+
+    /**
+     * @brief DeclarationsImporter::statistics
+     * @return
+     */
+    DeclarationsImporter::Statistics DeclarationsImporter::statistics() const
+    {
+        return m_Statistics;
+    }
+
+    /**
+     * @brief DeclarationsImporter::reset
+     */
+    void DeclarationsImporter::reset()
+    {
+        m_Frames.clear();
+        m_Statement.clear();
+        m_StatementLine = 0;
+        m_InComment = false;
+        m_InDirective = false;
+
+        m_Types.clear();
+        m_TypesByName.clear();
+        m_TargetMethods.clear();
+        m_TargetFields.clear();
+
+        m_PendingTypes.clear();
+        m_PendingOrder.clear();
+        m_ExistingExtendedTypes.clear();
+
+        m_Errors.clear();
+        m_Statistics = Statistics();
+    }
+
+    /**
+     * @brief DeclarationsImporter::currentFrame
+     * @return innermost class, or target class on the top level
+     */
+    DeclarationsImporter::Frame *DeclarationsImporter::currentFrame()
+    {
+        if (!m_Frames.isEmpty() && m_Frames.last().context == Context::Class)
+            return &m_Frames.last();
+
+        return m_Target ? &m_TargetFrame : nullptr;
+    }
+
+    /**
+     * @brief DeclarationsImporter::processLine
+     * @param line
+     */
+    void DeclarationsImporter::processLine(const QString &line)
+    {
+        ++m_Statistics.lines;
+
+        QString code = stripComments(line, m_InComment);
+
+        // Preprocessor directives, including continued lines
+        if (m_InDirective || code.trimmed().startsWith('#')) {
+            m_InDirective = code.trimmed().endsWith('\\');
+            return;
+        }
+
+        code.remove(qtMacroRegex());
+
+        for (const QChar &c : code) {
+            if (!m_Frames.isEmpty() && m_Frames.last().context == Context::Body) {
+                if (c == '{')
+                    m_Frames << Frame{Context::Body, nullptr, Entity::Public, false, false};
+                else if (c == '}')
+                    m_Frames.removeLast();
+                continue;
+            }
+
+            if (c == '{') {
+                openBlock();
+            } else if (c == '}') {
+                closeBlock();
+            } else if (c == ';') {
+                processStatement(m_Statement);
+                m_Statement.clear();
+            } else if (c != ':' || !processAccessSpecifier()) {
+                if (!c.isSpace() && m_Statement.trimmed().isEmpty())
+                    m_StatementLine = m_Statistics.lines;
+                m_Statement += c;
+            }
+        }
+
+        m_Statement += ' ';
+    }
+
+    /**
+     * @brief DeclarationsImporter::openBlock
+     */
+    void DeclarationsImporter::openBlock()
+    {
+        const QString header = m_Statement.simplified();
+        m_Statement.clear();
+
+        auto match = classHeaderRegex().match(header);
+        if (match.hasMatch()) {
+            // Nested classes are not supported, so their bodies are skipped as a whole
+            if (!m_Frames.isEmpty() && m_Frames.last().context == Context::Class) {
+                m_Frames << Frame{Context::Body, nullptr, Entity::Public, false, false};
+                return;
+            }
+
+            auto cls = std::make_shared<Entity::Class>(match.captured(2), m_ScopeId);
+            const bool isStruct = match.captured(1) == "struct";
+            if (isStruct)
+                cls->setKind(Entity::StructType);
+
+            m_Types << cls;
+            m_TypesByName.insert(cls->name(), cls);
+            ++m_Statistics.classes;
+
+            m_Frames << Frame{Context::Class, cls, isStruct ? Entity::Public : Entity::Private,
+                              false, false};
+            return;
+        }
+
+        if (namespaceRegex().match(header).hasMatch()) {
+            m_Frames << Frame{Context::Namespace, nullptr, Entity::Public, false, false};
+            return;
+        }
+
+        // Methods with inline bodies, brace initializers, enums, etc.
+        processStatement(header);
+        m_Frames << Frame{Context::Body, nullptr, Entity::Public, false, false};
+    }
+
+    /**
+     * @brief DeclarationsImporter::closeBlock
+     */
+    void DeclarationsImporter::closeBlock()
+    {
+        m_Statement.clear();
+        if (!m_Frames.isEmpty())
+            m_Frames.removeLast();
+    }
+
+    /**
+     * @brief DeclarationsImporter::processAccessSpecifier
+     * @return true if access specifier is found
+     */
+    bool DeclarationsImporter::processAccessSpecifier()
+    {
+        if (m_Frames.isEmpty() || m_Frames.last().context != Context::Class)
+            return false;
+
+        auto match = accessRegex().match(m_Statement.simplified());
+        if (!match.hasMatch())
+            return false;
+
+        static const QHash<QString, Entity::Section> sections = {
+            {"public", Entity::Public}, {"protected", Entity::Protected}, {"private", Entity::Private}
+        };
+
+        Frame &frame = m_Frames.last();
+        frame.isSignals = !match.captured(3).isEmpty();
+        frame.isSlots = !match.captured(2).isEmpty();
+        frame.section = frame.isSignals ? Entity::Public : sections[match.captured(1)];
+
+        m_Statement.clear();
+        return true;
+    }
+
+    /**
+     * @brief DeclarationsImporter::processStatement
+     * @param statement
+     */
+    void DeclarationsImporter::processStatement(const QString &statement)
+    {
+        QString s = statement.simplified();
+        if (s.isEmpty() || skippedRegex().match(s).hasMatch())
+            return;
+
+        Frame *frame = currentFrame();
+        if (!frame)
+            return;
+
+        s = s.remove(ignoredSpecifiersRegex()).replace(plcRegex(), "\\1 ").simplified();
+
+        int bracket = s.indexOf('(');
+        if (bracket != -1) {
+            // Constructors and destructors have no return type, so they cannot be represented
+            const QString name = s.left(bracket).trimmed().section(' ', -1);
+            if (name.startsWith('~') || name == frame->cls->name())
+                return;
+
+            addMethod(s, *frame);
+        } else {
+            addField(s, *frame);
+        }
+    }
+
+    /**
+     * @brief DeclarationsImporter::addMethod
+     * @param signature
+     * @param frame
+     */
+    void DeclarationsImporter::addMethod(const QString &signature, Frame &frame)
+    {
+        ++m_Statistics.statements;
+
+        QString s = signature;
+        s.remove(defaultArgumentRegex());
+        s.replace(rhsAssignmentRegex(), " = \\1");
+
+        if (!m_Parser->parse(s, Models::DisplayPart::Methods)) {
+            addError(QObject::tr("cannot parse method \"%1\"").arg(signature));
+            return;
+        }
+
+        const Tokens tokens = m_Parser->tokens();
+
+        auto method = std::make_shared<Entity::ClassMethod>(
+                          text(tokens[int(MethodsGroupsNames::Name)]));
+        method->setSection(frame.section);
+        method->setIsSlot(frame.isSlots);
+        method->setIsSignal(frame.isSignals);
+
+        auto lhs = lhsIdentificators.find(text(tokens[int(MethodsGroupsNames::LhsKeywords)]));
+        if (lhs != lhsIdentificators.end())
+            method->addLhsIdentificator(*lhs);
+
+        method->setConstStatus(!text(tokens[int(MethodsGroupsNames::Const)]).isEmpty());
+
+        auto rhs = rhsIdentificators.find(text(tokens[int(MethodsGroupsNames::RhsKeywords)]));
+        if (rhs != rhsIdentificators.end())
+            method->setRhsIdentificator(*rhs);
+
+        const auto &returnType = tokens[int(MethodsGroupsNames::ReturnType)];
+        if (returnType && returnType->isMulti())
+            addTypeReference(returnType->tokens(),
+                             [method](const Common::ID &id) { method->setReturnTypeId(id); });
+
+        const auto &arguments = tokens[int(MethodsGroupsNames::Arguments)];
+        if (arguments && arguments->isMulti()) {
+            for (auto &&argument : arguments->tokens()) {
+                const Tokens argTokens = argument->tokens();
+                auto parameter = method->addParameter(text(argTokens[int(Argument::Name)]),
+                                                      Common::ID::nullID());
+
+                const auto &type = argTokens[int(Argument::Type)];
+                if (type && type->isMulti())
+                    addTypeReference(type->tokens(),
+                                     [parameter](const Common::ID &id) { parameter->setTypeId(id); });
+            }
+        }
+
+        if (frame.cls == m_Target)
+            m_TargetMethods << method;
+        else
+            frame.cls->addExistsMethod(method);
+
+        ++m_Statistics.components;
+    }
+
+    /**
+     * @brief DeclarationsImporter::addField
+     * @param signature
+     * @param frame
+     */
+    void DeclarationsImporter::addField(const QString &signature, Frame &frame)
+    {
+        ++m_Statistics.statements;
+
+        // Default member initializer is not a part of signature
+        const QString s = signature.section('=', 0, 0).trimmed();
+        if (!m_Parser->parse(s, Models::DisplayPart::Fields)) {
+            addError(QObject::tr("cannot parse field \"%1\"").arg(signature));
+            return;
+        }
+
+        const Tokens tokens = m_Parser->tokens();
+
+        auto field = std::make_shared<Entity::Field>(text(tokens[int(FieldGroupNames::Name)]),
+                                                     Common::ID::nullID());
+        field->setSection(frame.section);
+
+        auto keyword = fieldKeywords.find(text(tokens[int(FieldGroupNames::LhsKeywords)]));
+        if (keyword != fieldKeywords.end())
+            field->addKeyword(*keyword);
+
+        // Field type groups have the same order as type groups, shifted by lhs keywords group
+        Tokens typeTokens(int(TypeGroups::GroupsCount));
+        for (int i = int(TypeGroups::ConstStatus); i < int(TypeGroups::GroupsCount); ++i)
+            typeTokens[i] = tokens[i + int(FieldGroupNames::LhsKeywords)];
+        addTypeReference(typeTokens, [field](const Common::ID &id) { field->setTypeId(id); });
+
+        if (frame.cls == m_Target)
+            m_TargetFields << field;
+        else
+            frame.cls->addExistsField(field);
+
+        ++m_Statistics.components;
+    }
+
+    /**
+     * @brief DeclarationsImporter::addTypeReference
+     * @param typeTokens
+     * @param setter
+     */
+    void DeclarationsImporter::addTypeReference(const Tokens &typeTokens, const IdSetter &setter)
+    {
+        if (typeTokens.size() < int(TypeGroups::GroupsCount))
+            return;
+
+        const QString typeName = text(typeTokens[int(TypeGroups::Typename)]);
+        if (typeName.isEmpty())
+            return;
+
+        const QString constStatus = text(typeTokens[int(TypeGroups::ConstStatus)]);
+        const QString templateArgs = text(typeTokens[int(TypeGroups::TemplateArgs)]);
+        const QString plc = text(typeTokens[int(TypeGroups::PLC)]).remove(QChar::Space);
+
+        QString key = text(typeTokens[int(TypeGroups::Namespaces)]) + typeName;
+        if (!constStatus.isEmpty())
+            key.prepend("const ");
+        if (!templateArgs.isEmpty())
+            key += "<" + normalizedTemplateArgs(templateArgs) + ">";
+        if (!plc.isEmpty())
+            key += " " + plc;
+
+        auto it = m_PendingTypes.find(key);
+        if (it == m_PendingTypes.end()) {
+            it = m_PendingTypes.insert(key, {typeTokens, {}});
+            m_PendingOrder << key;
+        }
+
+        it->setters << setter;
+    }
+
+    /**
+     * @brief DeclarationsImporter::resolveTypes
+     */
+    void DeclarationsImporter::resolveTypes()
+    {
+        collectExtendedTypes();
+
+        for (auto &&key : m_PendingOrder) {
+            const PendingType &pending = m_PendingTypes[key];
+            const Tokens &tokens = pending.tokens;
+
+            auto type = findType(text(tokens[int(TypeGroups::Namespaces)]) +
+                                 text(tokens[int(TypeGroups::Typename)]));
+
+            const bool isConst = !text(tokens[int(TypeGroups::ConstStatus)]).isEmpty();
+            const QString templateArgs = text(tokens[int(TypeGroups::TemplateArgs)]);
+            const QString plc = text(tokens[int(TypeGroups::PLC)]);
+
+            if (isConst || !templateArgs.isEmpty() || !plc.isEmpty()) {
+                auto extendedType = std::make_shared<Entity::ExtendedType>(key, m_ScopeId);
+                extendedType->setTypeId(type->id());
+                extendedType->setConstStatus(isConst);
+
+                for (auto &&arg : templateArgs.splitRef(',', QString::SkipEmptyParts))
+                    extendedType->addTemplateParameter(findType(arg.trimmed().toString())->id());
+
+                for (int i = 0; i < plc.size(); ++i) {
+                    if (plc[i] == '&') {
+                        extendedType->addLinkStatus();
+                    } else if (plc[i] == '*') {
+                        const bool constPointer = plc.midRef(i + 1).trimmed().startsWith("const");
+                        extendedType->addPointerStatus(constPointer);
+                    }
+                }
+
+                if (auto existing = findExtendedType(*extendedType)) {
+                    type = existing;
+                } else {
+                    m_Types << extendedType;
+                    type = extendedType;
+                }
+            }
+
+            for (auto &&setter : pending.setters)
+                setter(type->id());
+        }
+
+        m_PendingTypes.clear();
+        m_PendingOrder.clear();
+        m_ExistingExtendedTypes.clear();
+    }
+
+    /**
+     * @brief DeclarationsImporter::collectExtendedTypes
+     */
+    void DeclarationsImporter::collectExtendedTypes()
+    {
+        m_ExistingExtendedTypes.clear();
+
+        for (auto &&searcher : m_Searchers) {
+            auto scopeSearcher = std::dynamic_pointer_cast<DB::IScopeSearcher>(searcher);
+            if (!scopeSearcher)
+                continue;
+
+            if (auto scope = scopeSearcher->scope(m_ScopeId, true /*searchInDepth*/)) {
+                for (auto &&type : scope->types())
+                    if (auto extendedType = std::dynamic_pointer_cast<Entity::ExtendedType>(type))
+                        m_ExistingExtendedTypes.insert(extendedType->typeId(), extendedType);
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief DeclarationsImporter::findExtendedType
+     * @param pattern
+     * @return existing type of the target scope with the same base type and modifiers
+     */
+    Entity::SharedExtendedType DeclarationsImporter::findExtendedType(
+        const Entity::ExtendedType &pattern) const
+    {
+        for (auto it = m_ExistingExtendedTypes.find(pattern.typeId());
+             it != m_ExistingExtendedTypes.end() && it.key() == pattern.typeId(); ++it) {
+            if (hasSameModifiers(**it, pattern))
+                return *it;
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief DeclarationsImporter::findType
+     * @param name
+     * @return imported or existing type. New type is created for unknown names
+     */
+    Entity::SharedType DeclarationsImporter::findType(const QString &name)
+    {
+        if (auto type = m_TypesByName.value(name))
+            return type;
+
+        for (auto &&searcher : m_Searchers) {
+            if (auto type = searcher ? searcher->typeByName(name) : nullptr) {
+                m_TypesByName.insert(name, type);
+                return type;
+            }
+        }
+
+        auto type = std::make_shared<Entity::Type>(name.section("::", -1), m_ScopeId);
+        m_Types << type;
+        m_TypesByName.insert(name, type);
+
+        return type;
+    }
+
+    /**
+     * @brief DeclarationsImporter::addError
+     * @param message
+     */
+    void DeclarationsImporter::addError(const QString &message)
+    {
+        m_Errors << QObject::tr("Line %1: %2").arg(m_StatementLine).arg(message);
+        ++m_Statistics.errors;
+    }
+
+} // namespace Components
@@ -0,0 +1,141 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <functional>
+
+#include <QHash>
+#include <QStringList>
+#include <QVector>
+
+#include <Common/ID.h>
+#include <DB/DBTypes.hpp>
+#include <Entity/EntityTypes.hpp>
+
+#include "components_types.h"
+
+class QTextStream;
+
+namespace Components {
+
+    /// Imports C++ declarations (e.g. a whole header) as classes with methods and fields.
+    /// Input is processed line by line, so large files are never kept in memory as a whole.
+    /// Types are resolved in one pass after parsing, each distinct type only once.
+    /// Modified types (const, pointers, etc.) which already exist in the scope are reused.
+    /// Bodies of nested classes are skipped.
+    class DeclarationsImporter
+    {
+    public:
+        /// Import statistics
+        struct Statistics
+        {
+            int lines      = 0; ///< Processed lines
+            int statements = 0; ///< Parsed declarations
+            int classes    = 0; ///< Imported classes
+            int components = 0; ///< Imported methods and fields
+            int errors     = 0; ///< Declarations which were not recognized
+            qint64 elapsed = 0; ///< Import time, ms
+
+            double linesPerSecond() const;
+        };
+
+        DeclarationsImporter(DB::SharedTypeSearchers searchers, const Common::ID &scopeId);
+        ~DeclarationsImporter();
+
+        void setTargetClass(const Entity::SharedClass &target);
+        Entity::SharedClass targetClass() const;
+
+        bool import(QTextStream &stream);
+        bool import(const QString &text);
+
+        Entity::TypesList types() const;
+        Entity::MethodsList targetMethods() const;
+        Entity::FieldsList targetFields() const;
+
+        QStringList errors() const;
+        Statistics statistics() const;
+
+    private:
+        enum class Context { Namespace, Class, Body };
+        using IdSetter = std::function<void(const Common::ID &)>;
+
+        struct Frame
+        {
+            Context context;
+            Entity::SharedClass cls;
+            Entity::Section section;
+            bool isSlots;
+            bool isSignals;
+        };
+
+        struct PendingType
+        {
+            Tokens tokens;
+            QVector<IdSetter> setters;
+        };
+
+        void reset();
+        Frame *currentFrame();
+        void processLine(const QString &line);
+        void openBlock();
+        void closeBlock();
+        bool processAccessSpecifier();
+        void processStatement(const QString &statement);
+
+        void addMethod(const QString &signature, Frame &frame);
+        void addField(const QString &signature, Frame &frame);
+
+        void addTypeReference(const Tokens &typeTokens, const IdSetter &setter);
+        void resolveTypes();
+        void collectExtendedTypes();
+        Entity::SharedExtendedType findExtendedType(const Entity::ExtendedType &pattern) const;
+        Entity::SharedType findType(const QString &name);
+
+        void addError(const QString &message);
+
+        DB::SharedTypeSearchers m_Searchers;
+        Common::ID m_ScopeId;
+        Entity::SharedClass m_Target;
+        UniqueSignatureParser m_Parser;
+
+        QVector<Frame> m_Frames;
+        Frame m_TargetFrame;
+        QString m_Statement;
+        int m_StatementLine = 0;
+        bool m_InComment = false;
+        bool m_InDirective = false;
+
+        Entity::TypesList m_Types;
+        Entity::TypesByName m_TypesByName;
+        Entity::MethodsList m_TargetMethods;
+        Entity::FieldsList m_TargetFields;
+
+        QHash<QString, PendingType> m_PendingTypes;
+        QStringList m_PendingOrder;
+        QMultiHash<Common::ID, Entity::SharedExtendedType> m_ExistingExtendedTypes; // By base type
+
+        QStringList m_Errors;
+        Statistics m_Statistics;
+    };
+
+} // namespace Components
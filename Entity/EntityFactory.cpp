@@ -26,8 +26,6 @@
 
 #include <QGraphicsScene>
 
-#include <Commands/MoveGraphicObject.h>
-
 #include <Entity/Converters/ConvertersTypes.hpp>
 #include <Entity/Converters/EnumTextConversionStrategy.hpp>
 
@@ -43,6 +41,8 @@
 
 #include <Project/Project.h>
 
+#include <Translation/signaturemaker.h>
+
 namespace Entity {
 
     namespace {
@@ -67,12 +67,16 @@ namespace Entity {
 
         void addGraphicEntity(const QPointer<QGraphicsScene> &scene,
                               const DB::SharedProjectDatabase &projectDB,
-                              const Commands::SharedCommandStack &commandStack,
+                              const DB::SharedDatabase &globalDB,
                               const Entity::SharedType &type,
                               const QPointF pos = QPointF())
         {
             if (scene && projectDB) {
                 auto graphicEntity = new Graphics::GraphisEntity(type);
+                graphicEntity->setSignatureMaker(
+                    std::make_unique<Translation::SignatureMaker>(
+                        globalDB, projectDB, projectDB->scope(type->scopeId(), true /*searchInDepth*/),
+                        type));
 
                 // Register in the database
                 projectDB->registerGraphicsEntity(graphicEntity);
@@ -84,20 +88,6 @@ namespace Entity {
                 // and signal about changing position will be emitted
                 if (!pos.isNull())
                     graphicEntity->setPos(pos);
-
-                // Connect only after position has changed
-                Q_ASSERT(commandStack);
-                G_CONNECT(graphicEntity, &Graphics::GraphisEntity::moved,
-                          [graphicEntity, commandStack](auto &&from, auto &&to) {
-                              if (!graphicEntity)
-                                  return;
-
-                              auto cmd =
-                                  Commands::make<Commands::MoveGraphicObject>(
-                                      *graphicEntity, G_ASSERT(graphicEntity->typeObject())->name(),
-                                      from, to);
-                              G_ASSERT(commandStack)->push(cmd.release());
-                          });
             }
         }
 
@@ -140,7 +130,7 @@ namespace Entity {
                 Q_ASSERT(!options.testFlag(AddToDatabase));
 
                 if (project() && options.testFlag(AddToScene))
-                    addGraphicEntity(scene(), project()->database(), commandStack(), type, pos);
+                    addGraphicEntity(scene(), project()->database(), globalDatabase(), type, pos);
 
                 if (project() && options.testFlag(AddToTreeModel))
                     if (auto tm = treeModel())
@@ -182,7 +172,7 @@ namespace Entity {
                 result->fromJson(src, errors);
                 if (errors.isEmpty()) {
                     if (addToScene && project())
-                        addGraphicEntity(scene(), project()->database(), commandStack(), result);
+                        addGraphicEntity(scene(), project()->database(), globalDatabase(), result);
 
                     return result;
                 }
@@ -195,6 +185,36 @@ namespace Entity {
         return nullptr;
     }
 
+    /**
+     * @brief EntityFactory::make
+     * @param src
+     * @param errors
+     * @param scope
+     * @return
+     */
+    SharedType EntityFactory::make(const QJsonObject &src, ErrorList &errors,
+                                   const SharedScope &scope) const
+    {
+        if (!scope || !src.contains(Entity::Type::kindMarker())) {
+            errors << "Cannot create object.";
+            return nullptr;
+        }
+
+        auto kind = KindOfType(src[Entity::Type::kindMarker()].toInt());
+        if (auto maker = makers[kind]) {
+            if (auto type = maker(scope)) {
+                if (auto it = strategies.constFind(type->kindOfType()); it != std::cend(strategies))
+                    type->setTextConversionStrategy(*it);
+
+                type->fromJson(src, errors);
+                return type;
+            }
+        }
+
+        errors << "Cannot create object.";
+        return nullptr;
+    }
+
     /**
      * @brief EntityFactory::init
      */
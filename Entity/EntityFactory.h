@@ -52,6 +52,7 @@ namespace Entity {
         SharedType make(const QJsonObject &src, ErrorList &errors,
                         const Common::ID &scopeID = Common::ID::projectScopeID(),
                         CreationOptions options = EntityCommon) const;
+        SharedType make(const QJsonObject &src, ErrorList &errors, const SharedScope &scope) const;
 
         void init() override;
 
@@ -130,7 +130,11 @@ namespace Entity {
      */
     void Enumerator::setValue(const OptionalValue &value)
     {
+        if (m_Value == value)
+            return;
+
         m_Value = value;
+        emit changed();
     }
 
     /**
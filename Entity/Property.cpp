@@ -143,8 +143,10 @@ namespace Entity {
      */
     Property &Property::setName(const QString &name)
     {
-        if (G_ASSERT(m_Field))
+        if (G_ASSERT(m_Field) && m_Field->name() != name) {
             m_Field->setName(name);
+            emit changed();
+        }
 
         return *this;
     }
@@ -185,6 +187,7 @@ namespace Entity {
 
         emit fieldAdded(safeShared(), m_Field);
         emit fieldRemoved(safeShared(), oldField);
+        emit changed();
 
         return *this;
     }
@@ -921,8 +924,10 @@ namespace Entity {
      */
     void Property::setTypeId(const Common::ID &typeId)
     {
-        if (G_ASSERT(m_Field))
+        if (G_ASSERT(m_Field) && m_Field->typeId() != typeId) {
             m_Field->setTypeId(typeId);
+            emit changed();
+        }
     }
 
 } // namespace entity
@@ -171,7 +171,7 @@ namespace Entity {
     SharedType Scope::addExistsType(const SharedType &type)
     {
         type->setScopeId(m_Id);
-        uniquifyName(*type, m_TypesByName.keys());
+        uniquifyName(*type, m_TypesByName);
 
         Q_ASSERT(!m_Types.contains(type->id()));
         Q_ASSERT(!m_TypesByName.contains(type->name()));
@@ -179,7 +179,11 @@ namespace Entity {
         connectType(type.get());
 
         m_TypesByName[type->name()] = type;
-        return *m_Types.insert(type->id(), type);
+        m_Types.insert(type->id(), type);
+
+        emit typeAdded(type);
+
+        return type;
     }
 
     /**
@@ -213,6 +217,9 @@ namespace Entity {
             m_TypesByName.remove(type->name());
 
         m_Types.remove(typeId);
+
+        if (type)
+            emit typeRemoved(type);
     }
 
     /**
@@ -243,6 +250,10 @@ namespace Entity {
     {
         SharedScope scope = std::make_shared<Scope>(name, m_Id);
         m_Scopes.insert(scope->id(), scope);
+
+        connectChildScope(scope.get());
+        emit childScopeAdded(scope);
+
         return scope;
     }
 
@@ -266,6 +277,9 @@ namespace Entity {
             Q_ASSERT(!m_Scopes.contains(scope->id()));
             scope->setScopeId(m_Id);
             m_Scopes[scope->id()] = scope;
+
+            connectChildScope(scope.get());
+            emit childScopeAdded(scope);
         }
     }
 
@@ -294,7 +308,10 @@ namespace Entity {
      */
     void Scope::removeChildScope(const Common::ID &typeId)
     {
-        m_Scopes.remove(typeId);
+        if (auto scope = m_Scopes.take(typeId)) {
+            connectChildScope(scope.get(), false /*connect*/);
+            emit childScopeRemoved(scope);
+        }
     }
 
     /**
@@ -336,7 +353,9 @@ namespace Entity {
     {
         BasicElement::fromJson(src, errorList);
 
-        m_Scopes.clear();
+        for (auto &&scope : m_Scopes.values())
+            removeChildScope(scope->id());
+
         Util::checkAndSet(src, "Scopes", errorList, [&src, &errorList, this](){
             if (src["Scopes"].isArray()) {
                 SharedScope scope;
@@ -344,13 +363,18 @@ namespace Entity {
                     scope = std::make_shared<Scope>();
                     scope->fromJson(val.toObject(), errorList);
                     m_Scopes.insert(scope->id(), scope);
+
+                    connectChildScope(scope.get());
+                    emit childScopeAdded(scope);
                 }
             } else {
                 errorList << "Error: \"Scopes\" is not array";
             }
         });
 
-        m_Types.clear();
+        for (auto &&type : m_Types.values())
+            removeType(type->id());
+
         m_TypesByName.clear();
         Util::checkAndSet(src, "Types", errorList, [&src, &errorList, this](){
             if (src["Types"].isArray()) {
@@ -380,6 +404,8 @@ namespace Entity {
 
             m_TypesByName[newName] = type;
             m_Types[type->id()] = type;
+
+            emit typeRenamed(type, oldName);
         } else {
             qWarning() << "Wrong new type name: " << newName << ", old was: " << oldName;
         }
@@ -401,11 +427,35 @@ namespace Entity {
 
             m_TypesByName[type->name()] = type;
             m_Types[newID] = type;
+
+            emit typeIdChanged(type, oldID);
         } else {
             qWarning() << "Wrong new type ID: " << newID.value() << ", old was: " << oldID.value();
         }
     }
 
+    /**
+     * @brief Scope::onChildScopeIdChanged
+     * @param oldID
+     * @param newID
+     */
+    void Scope::onChildScopeIdChanged(const Common::ID &oldID, const Common::ID &newID)
+    {
+        auto it = m_Scopes.find(oldID);
+        if (!m_Scopes.contains(newID) && it != m_Scopes.end()) {
+            auto scope = *it;
+            m_Scopes.erase(it);
+
+            Q_ASSERT(scope->id() == newID);
+
+            m_Scopes[newID] = scope;
+
+            emit childScopeIdChanged(scope, oldID);
+        } else {
+            qWarning() << "Wrong new scope ID: " << newID.value() << ", old was: " << oldID.value();
+        }
+    }
+
     /**
      * @brief Scope::onTemplateMethodAdded
      * @param m
@@ -424,6 +474,12 @@ namespace Entity {
         Util::deepCopySharedPointerHash(src.m_Scopes, m_Scopes, &Scope::id);
         Util::deepCopySharedPointerHash(src.m_Types,  m_Types, &Type::id);
         Util::deepCopySharedPointerHash(src.m_TypesByName,  m_TypesByName, &Type::name);
+
+        for (auto &&scope : m_Scopes)
+            connectChildScope(scope.get());
+
+        for (auto &&type : m_Types)
+            connectType(type.get());
     }
 
     /**
@@ -435,6 +491,17 @@ namespace Entity {
         m_Scopes      = std::move(src.m_Scopes);
         m_Types       = std::move(src.m_Types );
         m_TypesByName = std::move(src.m_TypesByName);
+
+        // Child elements are still connected to the source scope
+        for (auto &&scope : m_Scopes) {
+            QObject::disconnect(scope.get(), nullptr, &src, nullptr);
+            connectChildScope(scope.get());
+        }
+
+        for (auto &&type : m_Types) {
+            QObject::disconnect(type.get(), nullptr, &src, nullptr);
+            connectType(type.get());
+        }
     }
 
     /**
@@ -480,4 +547,36 @@ namespace Entity {
         G_CONNECT(t, &Common::BasicElement::idChanged, this, &Entity::Scope::onTypeIdChanged);
     }
 
+    /**
+     * @brief Scope::connectChildScope
+     * @param scope
+     * @param connect
+     */
+    void Scope::connectChildScope(Scope *scope, bool connect)
+    {
+        if (!scope)
+            return;
+
+        // Forward the child scope notifications, so only the top level scopes have to be observed
+        if (connect) {
+            G_CONNECT(scope, &Common::BasicElement::idChanged, this, &Scope::onChildScopeIdChanged);
+            G_CONNECT(scope, &Scope::childScopeIdChanged, this, &Scope::childScopeIdChanged);
+            G_CONNECT(scope, &Scope::typeAdded, this, &Scope::typeAdded);
+            G_CONNECT(scope, &Scope::typeRemoved, this, &Scope::typeRemoved);
+            G_CONNECT(scope, &Scope::typeRenamed, this, &Scope::typeRenamed);
+            G_CONNECT(scope, &Scope::typeIdChanged, this, &Scope::typeIdChanged);
+            G_CONNECT(scope, &Scope::childScopeAdded, this, &Scope::childScopeAdded);
+            G_CONNECT(scope, &Scope::childScopeRemoved, this, &Scope::childScopeRemoved);
+        } else {
+            G_DISCONNECT(scope, &Common::BasicElement::idChanged, this, &Scope::onChildScopeIdChanged);
+            G_DISCONNECT(scope, &Scope::childScopeIdChanged, this, &Scope::childScopeIdChanged);
+            G_DISCONNECT(scope, &Scope::typeAdded, this, &Scope::typeAdded);
+            G_DISCONNECT(scope, &Scope::typeRemoved, this, &Scope::typeRemoved);
+            G_DISCONNECT(scope, &Scope::typeRenamed, this, &Scope::typeRenamed);
+            G_DISCONNECT(scope, &Scope::typeIdChanged, this, &Scope::typeIdChanged);
+            G_DISCONNECT(scope, &Scope::childScopeAdded, this, &Scope::childScopeAdded);
+            G_DISCONNECT(scope, &Scope::childScopeRemoved, this, &Scope::childScopeRemoved);
+        }
+    }
+
 } // namespace entity
@@ -85,17 +85,28 @@ namespace Entity {
     public slots:
         void onTypeNameChanged(const QString &oldName, const QString &newName);
         void onTypeIdChanged(const Common::ID &oldID, const Common::ID &newID);
+        void onChildScopeIdChanged(const Common::ID &oldID, const Common::ID &newID);
         void onTemplateMethodAdded(const SharedTemplateClassMethod &m);
 
     signals:
         void typeSearcherRequired(const SharedTypeUser &);
 
+        // Emitted for this scope and forwarded from all child scopes
+        void typeAdded(const Entity::SharedType &type);
+        void typeRemoved(const Entity::SharedType &type);
+        void typeRenamed(const Entity::SharedType &type, const QString &oldName);
+        void typeIdChanged(const Entity::SharedType &type, const Common::ID &oldID);
+        void childScopeAdded(const Entity::SharedScope &scope);
+        void childScopeRemoved(const Entity::SharedScope &scope);
+        void childScopeIdChanged(const Entity::SharedScope &scope, const Common::ID &oldID);
+
     private:
         void copyFrom(const Scope &src);
         void moveFrom(Scope &&src) noexcept;
 
         void connectType(Type * t);
         void connectTemplate(Template *t);
+        void connectChildScope(Scope *scope, bool connect = true);
 
         Scopes m_Scopes;
         Types  m_Types;
@@ -109,13 +120,15 @@ namespace Entity {
                                                      std::is_base_of<Type, T>::value,
                                                      T, Type>::type;
         auto value = std::make_shared<ResultType>(name, m_Id);
-        uniquifyName(*value, m_TypesByName.keys());
+        uniquifyName(*value, m_TypesByName);
 
         m_Types[value->id()] = value;
         m_TypesByName[value->name()] = value;
 
         connectType(value.get());
 
+        emit typeAdded(value);
+
         return value;
     }
 
@@ -45,6 +45,23 @@ namespace Entity {
         const QString kindOfTypeMark = "Kind of type";
         const QString graphicsDataMark = "Graphics entity data";
         QString defaultName() { return Type::tr("Type"); }
+
+        const GraphicEntityData &defaultGraphicsData()
+        {
+            static const GraphicEntityData data;
+            return data;
+        }
+
+        const GraphicEntityData &graphicsDataOrDefault(const SharedGraphicEntityData &data)
+        {
+            return data ? *data : defaultGraphicsData();
+        }
+
+        const QJsonObject &defaultGraphicsJson()
+        {
+            static const QJsonObject json = defaultGraphicsData().toJson();
+            return json;
+        }
     }
 
     /**
@@ -65,7 +82,7 @@ namespace Entity {
         : BasicElement(name, scopeId, typeId.isValid() ? typeId
                                                        : Helpers::GeneratorID::instance().genID() )
         , m_KindOfType(KindOfType::Type)
-        , m_GraphicEntityData(std::make_shared<GraphicEntityData>())
+        , m_GraphicEntityData(std::make_shared<GraphicEntityDataHolder>())
     {
         if (m_Name.isEmpty() || m_Name == DEFAULT_NAME)
             setBaseTypeName();
@@ -78,7 +95,7 @@ namespace Entity {
     Type::Type(const Type &src)
         : BasicElement(src)
         , m_KindOfType(src.m_KindOfType)
-        , m_GraphicEntityData(src.m_GraphicEntityData)
+        , m_GraphicEntityData(src.m_GraphicEntityData) // Copies share graphics data
         , m_TextConversionStrategy(src.m_TextConversionStrategy)
     {
     }
@@ -116,7 +133,8 @@ namespace Entity {
         QJsonObject result = BasicElement::toJson();
 
         result[kindOfTypeMark] = int(m_KindOfType);
-        result[graphicsDataMark] = G_ASSERT(m_GraphicEntityData)->toJson();
+        const SharedGraphicEntityData &data = G_ASSERT(m_GraphicEntityData)->data;
+        result[graphicsDataMark] = data ? data->toJson() : defaultGraphicsJson();
 
         return result;
     }
@@ -133,7 +151,10 @@ namespace Entity {
                              [&] { m_KindOfType = KindOfType(src[kindOfTypeMark].toInt()); });
         Util::checkAndSet(src, graphicsDataMark, errorList,
         [&] {
-            G_ASSERT(m_GraphicEntityData)->fromJson(src[graphicsDataMark].toObject(), errorList);
+            // Most of types are never shown on the scene, don't allocate the data for them
+            const QJsonObject data = src[graphicsDataMark].toObject();
+            if (G_ASSERT(m_GraphicEntityData)->data || data != defaultGraphicsJson())
+                graphicEntityData()->fromJson(data, errorList);
         });
     }
 
@@ -155,7 +176,8 @@ namespace Entity {
     {
         return rhs.hashType()   == this->hashType() &&
                rhs.m_KindOfType == m_KindOfType     &&
-               Util::sharedPtrEq(rhs.m_GraphicEntityData, m_GraphicEntityData) &&
+               graphicsDataOrDefault(G_ASSERT(rhs.m_GraphicEntityData)->data) ==
+               graphicsDataOrDefault(G_ASSERT(m_GraphicEntityData)->data) &&
                ( withTypeid ? m_Id == rhs.m_Id : true );
     }
 
@@ -178,11 +200,16 @@ namespace Entity {
 
     /**
      * @brief Type::graphicEntityData
+     * Data is allocated on the first access and is shared with all copies.
      * @return
      */
     SharedGraphicEntityData Type::graphicEntityData() const
     {
-        return m_GraphicEntityData;
+        SharedGraphicEntityData &data = G_ASSERT(m_GraphicEntityData)->data;
+        if (!data)
+            data = std::make_shared<GraphicEntityData>();
+
+        return data;
     }
 
     /**
@@ -191,7 +218,8 @@ namespace Entity {
      */
     void Type::setGraphicEntityData(const SharedGraphicEntityData &graphicEntityData)
     {
-        m_GraphicEntityData = graphicEntityData;
+        m_GraphicEntityData = std::make_shared<GraphicEntityDataHolder>();
+        m_GraphicEntityData->data = graphicEntityData;
     }
 
     /**
@@ -122,7 +122,14 @@ namespace Entity {
     private:
         void setBaseTypeName();
 
-        SharedGraphicEntityData m_GraphicEntityData;
+        /// Shared between copies, the data itself is allocated on the first access
+        struct GraphicEntityDataHolder
+        {
+            SharedGraphicEntityData data;
+        };
+        using SharedGraphicEntityDataHolder = std::shared_ptr<GraphicEntityDataHolder>;
+
+        SharedGraphicEntityDataHolder m_GraphicEntityData;
 
         Converters::SharedConversionStrategy m_TextConversionStrategy;
     };
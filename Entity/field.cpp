@@ -32,6 +32,8 @@
 
 #include <Utility/helpfunctions.h>
 
+#include <Common/StringPool.h>
+
 namespace Entity {
 
     /**
@@ -111,8 +113,13 @@ namespace Entity {
     Field &Field::operator =(const Field &rhs)
     {
         if (this != &rhs) {
+            const bool isChanged = !(*this == rhs);
+
             static_cast<BasicElement*>(this)->operator =(rhs);
             copyFrom(rhs);
+
+            if (isChanged)
+                emit changed();
         }
 
         return *this;
@@ -160,7 +167,11 @@ namespace Entity {
      */
     void Field::setSection(Section section)
     {
+        if (m_Section == section)
+            return;
+
         m_Section = section;
+        emit changed();
     }
 
     /**
@@ -177,7 +188,11 @@ namespace Entity {
      */
     void Field::removePrefix()
     {
+        if (m_Prefix.isEmpty())
+            return;
+
         m_Prefix.clear();
+        emit changed();
     }
 
     /**
@@ -186,7 +201,11 @@ namespace Entity {
      */
     void Field::setPrefix(const QString &prefix)
     {
+        if (m_Prefix == prefix)
+            return;
+
         m_Prefix = prefix;
+        emit changed();
     }
 
     /**
@@ -204,7 +223,11 @@ namespace Entity {
      */
     void Field::addKeyword(FieldKeyword keyword)
     {
+        if (m_Keywords.contains(keyword))
+            return;
+
         m_Keywords << keyword;
+        emit changed();
     }
 
     /**
@@ -232,7 +255,8 @@ namespace Entity {
      */
     void Field::removeKeyword(FieldKeyword keyword)
     {
-        m_Keywords.remove(keyword);
+        if (m_Keywords.remove(keyword))
+            emit changed();
     }
 
     /**
@@ -250,7 +274,11 @@ namespace Entity {
      */
     void Field::setTypeId(const Common::ID &typeId)
     {
+        if (m_TypeId == typeId)
+            return;
+
         m_TypeId = typeId;
+        emit changed();
     }
 
     /**
@@ -291,10 +319,10 @@ namespace Entity {
             m_Section = static_cast<Section>(src["Section"].toInt());
         });
         Util::checkAndSet(src, "Prefix",  errorList, [&src, this](){
-            m_Prefix = src["Prefix"].toString();
+            m_Prefix = Common::intern(src["Prefix"].toString());
         });
         Util::checkAndSet(src, "Suffix",  errorList, [&src, this](){
-            m_Suffix = src["Suffix"].toString();
+            m_Suffix = Common::intern(src["Suffix"].toString());
         });
         Util::checkAndSet(src, "DefaultValue",  errorList, [&src, this](){
             m_DefaultValue = src["DefaultValue"].toString();
@@ -355,7 +383,11 @@ namespace Entity {
      */
     void Field::removeSuffix()
     {
+        if (m_Suffix.isEmpty())
+            return;
+
         m_Suffix.clear();
+        emit changed();
     }
 
     /**
@@ -364,7 +396,11 @@ namespace Entity {
      */
     void Field::setSuffix(const QString &suffix)
     {
-       m_Suffix = suffix;
+        if (m_Suffix == suffix)
+            return;
+
+        m_Suffix = suffix;
+        emit changed();
     }
 
     /**
@@ -382,7 +418,11 @@ namespace Entity {
      */
     void Field::setDefaultValue(const QString &defaultValue)
     {
+        if (m_DefaultValue == defaultValue)
+            return;
+
         m_DefaultValue = defaultValue;
+        emit changed();
     }
 
     uint qHash(const SharedField &f)
@@ -15,12 +15,16 @@ set(CMD_HEADERS
     ${CMD}/CommandsTypes.h
     ${CMD}/MakeProjectCurrent.h
     ${CMD}/CreateScope.h
+    ${CMD}/ImportDeclarations.h
     ${CMD}/MoveGraphicObject.h
+    ${CMD}/ResizeGraphicEntity.h
+    ${CMD}/UndoMemoryLimiter.h
     ${CMD}/RemoveComponentsCommands.h
     ${CMD}/RenameEntity.h
     ${CMD}/AddComponentsCommands.h
     ${CMD}/CommandFactory.hpp
     ${CMD}/MementoCmd.hpp
+    ${CMD}/EditComponent.h
     ${CMD}/OpenProject.h)
 set(CMD_SRC
     ${CMD}/CreateEntity.cpp
@@ -29,12 +33,16 @@ set(CMD_SRC
     ${CMD}/BaseCommand.cpp
     ${CMD}/MakeProjectCurrent.cpp
     ${CMD}/CreateScope.cpp
+    ${CMD}/ImportDeclarations.cpp
     ${CMD}/MoveGraphicObject.cpp
+    ${CMD}/ResizeGraphicEntity.cpp
+    ${CMD}/UndoMemoryLimiter.cpp
     ${CMD}/RemoveComponentsCommands.cpp
     ${CMD}/RenameEntity.cpp
     ${CMD}/AddComponentsCommands.cpp
     ${CMD}/CommandFactory.cpp
     ${CMD}/MementoCmd.cpp
+    ${CMD}/EditComponent.cpp
     ${CMD}/OpenProject.cpp)
 
 set(DB ${ROOT}/DB)
@@ -43,11 +51,23 @@ set(DB_HEADERS
     ${DB}/ProjectDatabase.h
     ${DB}/IScopeSearcher.h
     ${DB}/ITypeSearcher.h
+    ${DB}/LazyLoader.h
+    ${DB}/BinaryFormat.h
     ${DB}/DBTypes.hpp)
 set(DB_SRC
     ${DB}/ProjectDatabase.cpp
+    ${DB}/LazyLoader.cpp
+    ${DB}/BinaryFormat.cpp
     ${DB}/Database.cpp)
 
+set(TOOLS ${ROOT}/Tools)
+set(DBCONVERT_SRC
+    ${TOOLS}/dbconvert.cpp
+    ${DB}/BinaryFormat.cpp)
+
+set(GENTOOL_SRC
+    ${TOOLS}/generate.cpp)
+
 set(ENTITY ${ROOT}/Entity)
 set(ENTITY_HEADERS
     ${ENTITY}/field.h
@@ -98,12 +118,14 @@ set(CONVERSION_SRC
 set(ENTITY_COMPONENTS ${ENTITY}/Components)
 set(ENTITY_COMPONNTS_HEADERS
     ${ENTITY_COMPONENTS}/componentsignatureparser.h
+    ${ENTITY_COMPONENTS}/declarationsimporter.h
     ${ENTITY_COMPONENTS}/icomponents.h
     ${ENTITY_COMPONENTS}/componentscommon.h
     ${ENTITY_COMPONENTS}/components_types.h
     ${ENTITY_COMPONENTS}/token.h)
 set(ENTITY_COMPONNTS_SRC
     ${ENTITY_COMPONENTS}/componentsignatureparser.cpp
+    ${ENTITY_COMPONENTS}/declarationsimporter.cpp
     ${ENTITY_COMPONENTS}/icomponents.cpp
     ${ENTITY_COMPONENTS}/token.cpp)
 
@@ -111,6 +133,7 @@ set(GEN ${ROOT}/Generator)
 set(GEN_HEADERS
     ${GEN}/abstractprojectgenerator.h
     ${GEN}/basiccppprojectgenerator.h
+    ${GEN}/generationmanifest.h
     ${GEN}/virtualdirectory.h
     ${GEN}/virtualfile.h
     ${GEN}/virtualfilesystemabstractitem.h
@@ -118,6 +141,7 @@ set(GEN_HEADERS
 set(GEN_SRC
     ${GEN}/abstractprojectgenerator.cpp
     ${GEN}/basiccppprojectgenerator.cpp
+    ${GEN}/generationmanifest.cpp
     ${GEN}/virtualdirectory.cpp
     ${GEN}/virtualfile.cpp
     ${GEN}/virtualfilesystemabstractitem.cpp)
@@ -160,6 +184,7 @@ set(GUI_GRAPHICS_HEADERS
     ${GUI_GRAPHICS}/Entity.h
     ${GUI_GRAPHICS}/GraphicsRelation.h
     ${GUI_GRAPHICS}/Scene.h
+    ${GUI_GRAPHICS}/SpatialGrid.h
     ${GUI_GRAPHICS}/GraphicsTypes.h
     ${GUI_GRAPHICS}/Common.h
     ${GUI_GRAPHICS}/HeaderEditorEventFilter.cpp)
@@ -167,6 +192,7 @@ set(GUI_GRAPHICS_SRC
     ${GUI_GRAPHICS}/Entity.cpp
     ${GUI_GRAPHICS}/GraphicsRelation.cpp
     ${GUI_GRAPHICS}/Scene.cpp
+    ${GUI_GRAPHICS}/SpatialGrid.cpp
     ${GUI_GRAPHICS}/HeaderEditorEventFilter.cpp)
 
 set(HELPERS ${ROOT}/Helpers)
@@ -198,11 +224,13 @@ set(PROJECT_HEADERS
     ${PROJECT}/Project.h
     ${PROJECT}/ProjectFactory.hpp
     ${PROJECT}/ProjectDB.hpp
+    ${PROJECT}/ProjectJournal.h
     ${PROJECT}/ProjectTypes.hpp)
 set(PROJECT_SRC
     ${PROJECT}/Project.cpp
     ${PROJECT}/ProjectDB.cpp
-    ${PROJECT}/ProjectFactory.cpp)
+    ${PROJECT}/ProjectFactory.cpp
+    ${PROJECT}/ProjectJournal.cpp)
 
 set(REL ${ROOT}/Relationship)
 set(REL_HEADERS
@@ -228,13 +256,17 @@ set(REL_SRC
 set(TRANSLATION ${ROOT}/Translation)
 set(TRANSLATION_HEADERS
     ${TRANSLATION}/code.h
+    ${TRANSLATION}/codebuilder.h
     ${TRANSLATION}/projecttranslator.h
     ${TRANSLATION}/translator_types.hpp
+    ${TRANSLATION}/translationsession.h
     ${TRANSLATION}/signaturemaker.h)
 set(TRANSLATION_SRC
     ${TRANSLATION}/code.cpp
+    ${TRANSLATION}/codebuilder.cpp
     ${TRANSLATION}/projecttranslator.cpp
-    ${TRANSLATION}/signaturemaker.cpp)
+    ${TRANSLATION}/signaturemaker.cpp
+    ${TRANSLATION}/translationsession.cpp)
 
 set(UTIL ${ROOT}/Utility)
 set(UTIL_HEADERS
@@ -250,14 +282,18 @@ set(COMMON_HEADERS
     ${COMMON}/meta.h
     ${COMMON}/ElementsFactory.h
     ${COMMON}/Memento.hpp
+    ${COMMON}/MementoDelta.hpp
     ${COMMON}/IOriginator.hpp
-    ${COMMON}/SharedFromThis.h)
+    ${COMMON}/SharedFromThis.h
+    ${COMMON}/StringPool.h)
 set(COMMON_SRC
     ${COMMON}/ElementsFactory.cpp
     ${COMMON}/BasicElement.cpp
     ${COMMON}/Memento.cpp
+    ${COMMON}/MementoDelta.cpp
     ${COMMON}/IOriginator.cpp
-    ${COMMON}/ID.cpp)
+    ${COMMON}/ID.cpp
+    ${COMMON}/StringPool.cpp)
 
 set(FREE_HEADERS
     ${ROOT}/enums.h
@@ -29,6 +29,7 @@
 #include <QLineEdit>
 #include <QGraphicsView>
 #include <QTextEdit>
+#include <QFile>
 #include <QFileDialog>
 #include <QMessageBox>
 #include <QCloseEvent>
@@ -42,11 +43,15 @@
 #include <QTableView>
 #include <QToolButton>
 #include <QHeaderView>
+#include <QTextStream>
+#include <QTimer>
 
 #include <range/v3/algorithm/for_each.hpp>
 
 #include <Application/Settings.h>
 
+#include <DB/ProjectDatabase.h>
+
 #include <Models/ApplicationModel.h>
 #include <Models/ProjectTreeModel.h>
 #include <Models/MessagesModel.h>
@@ -57,11 +62,15 @@
 #include <GUI/graphics/Scene.h>
 
 #include <Entity/Type.h>
+#include <Entity/Scope.h>
+#include <Entity/Components/declarationsimporter.h>
 
 #include <Commands/CreateScope.h>
+#include <Commands/ImportDeclarations.h>
 #include <Commands/MakeProjectCurrent.h>
 #include <Commands/RemoveProject.h>
 #include <Commands/OpenProject.h>
+#include <Commands/UndoMemoryLimiter.h>
 
 #include <Project/ProjectDB.hpp>
 #include <Project/ProjectFactory.hpp>
@@ -389,6 +398,51 @@ namespace GUI {
             QMessageBox::information(this, tr("Information"), tr("No current project."), QMessageBox::Ok);
     }
 
+    /**
+     * @brief MainWindow::onImportDeclarations
+     */
+    void MainWindow::onImportDeclarations()
+    {
+        auto project = m_ApplicationModel->currentProject();
+        if (!project) {
+            QMessageBox::information(this, tr("Information"), tr("No current project."), QMessageBox::Ok);
+            return;
+        }
+
+        QString path = QFileDialog::getOpenFileName(this, tr("Select C++ header"), QString(),
+                                                    tr("C++ headers (*.h *.hpp *.hxx *.hh);;All files (*)"));
+        if (path.isEmpty())
+            return;
+
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            m_MessagesModel->addMessage(Models::MessageType::Error, tr("Import failed"),
+                                        tr("Cannot open file %1: %2.").arg(path, file.errorString()));
+            return;
+        }
+
+        auto projectDb = G_ASSERT(project->database());
+        auto scope = G_ASSERT(projectDb->scope(Common::ID::projectScopeID()));
+
+        Components::DeclarationsImporter importer({projectDb, project->globalDatabase()}, scope->id());
+        QTextStream stream(&file);
+        importer.import(stream);
+
+        for (auto &&error : importer.errors())
+            m_MessagesModel->addMessage(Models::MessageType::Warning, tr("Declaration is skipped"), error);
+
+        const auto stats = importer.statistics();
+        m_MessagesModel->addMessage(Models::MessageType::Information, tr("Declarations are imported"),
+                                    tr("%1 classes, %2 components from %3 lines in %4 ms (%5 lines/s).")
+                                    .arg(stats.classes).arg(stats.components).arg(stats.lines)
+                                    .arg(stats.elapsed).arg(qRound64(stats.linesPerSecond())));
+
+        if (!importer.types().isEmpty())
+            G_ASSERT(m_CommandsStack)->push(
+                Commands::make<Commands::ImportDeclarations>(
+                    importer, scope, m_ApplicationModel->treeModel(), project->name()).release());
+    }
+
     /**
      * @brief MainWindow::createNewProject
      * @param name
@@ -409,9 +463,11 @@ namespace GUI {
                 switch (result) {
                     case QMessageBox::Yes:
                         currentProject->save();
+                        currentProject->waitForSaved();
                         break;
 
                     case QMessageBox::No:
+                        currentProject->discardJournal();
                         break;
 
                     case QMessageBox::Cancel:
@@ -504,6 +560,35 @@ namespace GUI {
         m_RelationActions << ui->actionAddAssociation    << ui->actionAddDependency
                           << ui->actionAddGeneralization << ui->actionAddAggregation
                           << ui->actionAddComposition;
+
+        // Undo history is unlimited unless limits are set in the settings. Count limit can be set
+        // only while the stack is empty
+        m_CommandsStack->setUndoLimit(App::Settings::undoLimit());
+        auto limiter = new Commands::UndoMemoryLimiter(
+                           *m_CommandsStack, qint64(App::Settings::undoMemoryLimit()) << 20, this);
+        G_CONNECT(limiter, &Commands::UndoMemoryLimiter::historyTrimmed,
+                  [this](int count, int undoLimit) {
+            m_MessagesModel->addMessage(Models::MessageType::Warning, tr("Undo history is trimmed"),
+                                        tr("%1 undo steps are dropped to keep the history within "
+                                           "the memory limit, at most %2 steps are kept now.")
+                                        .arg(count).arg(undoLimit));
+        });
+
+        // Changes are written to the project journal in batches, at most once per interval
+        if (int interval = App::Settings::autosaveInterval(); interval > 0) {
+            auto autosaveTimer = new QTimer(this);
+            autosaveTimer->setSingleShot(true);
+            autosaveTimer->setInterval(interval * 1000);
+            G_CONNECT(m_CommandsStack.get(), &QUndoStack::indexChanged,
+                      autosaveTimer, [autosaveTimer] {
+                if (!autosaveTimer->isActive())
+                    autosaveTimer->start();
+            });
+            G_CONNECT(autosaveTimer, &QTimer::timeout, this, [this] {
+                if (auto project = m_ApplicationModel->currentProject())
+                    project->autosave();
+            });
+        }
     }
 
     /**
@@ -546,6 +631,7 @@ namespace GUI {
         G_CONNECT(ui->actionPreferences, &QAction::triggered, m_Preferences, &QWidget::show);
         G_CONNECT(ui->actionAbout, &QAction::triggered, m_AboutWidget, &QWidget::show);
         G_CONNECT(ui->actionNewProject, &QAction::triggered, m_NewProjectDialog, &QWidget::show);
+        G_CONNECT(ui->actionSceneStatistics, &QAction::toggled, m_MainView, &View::setShowStatistics);
 
         G_CONNECT(m_MainScene.get(), &Graphics::Scene::selectedItemsChanged,
                   m_EntityProperties, &EntityProperties::onSelectedElementsChanged);
@@ -667,6 +753,7 @@ namespace GUI {
         bool state = !!m_ApplicationModel->currentProject();
 
         ui->actionCreateScope->setEnabled(state);
+        ui->actionImportDeclarations->setEnabled(state);
         ui->actionSaveProject->setEnabled(state && m_ApplicationModel->currentProject()->isModified());
         ui->actionCloseProject->setEnabled(state);
 
@@ -765,8 +852,10 @@ namespace GUI {
                 switch (result) {
                     case QMessageBox::Yes:
                         pr->save();
-                        [[fallthrough]];
+                        pr->waitForSaved();
+                        break;
                     case QMessageBox::No:
+                        pr->discardJournal();
                         break;
                     case QMessageBox::Abort:
                         needExit = false;
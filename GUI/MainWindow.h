@@ -88,6 +88,7 @@ namespace GUI {
 
     public slots:
         void onCreateScope();
+        void onImportDeclarations();
         void update();
 
     private slots:
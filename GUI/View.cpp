@@ -25,6 +25,7 @@
 #include <QDropEvent>
 #include <QByteArray>
 #include <QMimeData>
+#include <QPainter>
 #include <QDebug>
 
 #include <Project/Project.h>
@@ -34,9 +35,15 @@
 
 #include "Elements.h"
 #include "QtHelpers.h"
+#include <GUI/graphics/Common.h>
 
 namespace GUI {
 
+    namespace {
+        constexpr int statisticsInterval = 1000; // ms
+        const QMargins statisticsPadding(6, 4, 6, 4);
+    }
+
     /**
      * @brief View::View
      * @param parent
@@ -46,6 +53,8 @@ namespace GUI {
         : QGraphicsView(parent)
         , m_ApplicationModel(model)
         , m_CommandStack(std::move(cs))
+        , m_ShowStatistics(false)
+        , m_FramesCount(0)
     {
         setAcceptDrops(true);
 
@@ -105,6 +114,130 @@ namespace GUI {
         de->ignore();
     }
 
+    /**
+     * @brief View::showStatistics
+     * @return
+     */
+    bool View::showStatistics() const
+    {
+        return m_ShowStatistics;
+    }
+
+    /**
+     * @brief View::setShowStatistics
+     * @param show
+     */
+    void View::setShowStatistics(bool show)
+    {
+        if (m_ShowStatistics == show)
+            return;
+
+        m_ShowStatistics = show;
+        m_FramesCount = 0;
+        m_FrameTimer.start();
+        m_StatisticsText = tr("Measuring...");
+
+        viewport()->update();
+    }
+
+    /**
+     * @brief View::paintEvent
+     * @param event
+     */
+    void View::paintEvent(QPaintEvent *event)
+    {
+        QGraphicsView::paintEvent(event);
+
+        if (!m_ShowStatistics)
+            return;
+
+        ++m_FramesCount;
+        if (m_FrameTimer.elapsed() >= statisticsInterval)
+            updateStatistics();
+    }
+
+    /**
+     * @brief View::drawForeground
+     * @param painter
+     * @param rect
+     */
+    void View::drawForeground(QPainter *painter, const QRectF &rect)
+    {
+        QGraphicsView::drawForeground(painter, rect);
+
+        if (!m_ShowStatistics)
+            return;
+
+        painter->save();
+
+        // Draw in the viewport coordinates, overlay doesn't depend on zoom and scroll
+        painter->resetTransform();
+
+        QRect overlayRect(statisticsRect());
+        painter->fillRect(overlayRect, QColor(0, 0, 0, 160));
+        painter->setPen(Qt::white);
+        painter->drawText(overlayRect - statisticsPadding, Qt::AlignLeft | Qt::AlignVCenter,
+                          m_StatisticsText);
+
+        painter->restore();
+    }
+
+    /**
+     * @brief View::scrollContentsBy
+     * @param dx
+     * @param dy
+     */
+    void View::scrollContentsBy(int dx, int dy)
+    {
+        QGraphicsView::scrollContentsBy(dx, dy);
+
+        // Scrolled viewport contains moved copy of the overlay
+        if (m_ShowStatistics)
+            viewport()->update();
+    }
+
+    /**
+     * @brief View::updateStatistics
+     */
+    void View::updateStatistics()
+    {
+        int entities = 0;
+        int relations = 0;
+        if (auto s = scene()) {
+            for (auto &&item : s->items()) {
+                if (!item->isVisible())
+                    continue;
+
+                if (item->type() == QGraphicsItem::UserType + int(Graphics::ElementType::Entity))
+                    ++entities;
+                else if (item->type() == QGraphicsItem::UserType + int(Graphics::ElementType::Relation))
+                    ++relations;
+            }
+        }
+
+        qreal fps = m_FramesCount * 1000. / m_FrameTimer.elapsed();
+        m_StatisticsText = tr("Entities: %1, relations: %2, FPS: %3")
+                           .arg(entities).arg(relations).arg(fps, 0, 'f', 1);
+
+        m_FramesCount = 0;
+        m_FrameTimer.restart();
+
+        // Old text may be wider, so update the whole strip
+        viewport()->update(QRect(0, 0, viewport()->width(), statisticsRect().height()));
+    }
+
+    /**
+     * @brief View::statisticsRect
+     * @return
+     */
+    QRect View::statisticsRect() const
+    {
+        QRect textRect(fontMetrics().boundingRect(m_StatisticsText));
+        textRect.moveTopLeft(QPoint(0, 0));
+
+        return textRect + statisticsPadding;
+    }
+
     /**
      * @brief View::onCurrentProjectChanged
      * @param p
@@ -22,6 +22,7 @@
 *****************************************************************************/
 #pragma once
 
+#include <QElapsedTimer>
 #include <QGraphicsView>
 
 #include <Commands/CommandsTypes.h>
@@ -50,18 +51,34 @@ namespace GUI {
         void dragMoveEvent(QDragMoveEvent *de) override;
         void dragLeaveEvent(QDragLeaveEvent *de) override;
 
+        bool showStatistics() const;
+
+    protected: // QGraphicsView overrides
+        void paintEvent(QPaintEvent *event) override;
+        void drawForeground(QPainter *painter, const QRectF &rect) override;
+        void scrollContentsBy(int dx, int dy) override;
+
     public slots:
         void onCurrentProjectChanged(const Projects::SharedProject &previous,
                                      const Projects::SharedProject &current);
+        void setShowStatistics(bool show);
 
     private:
         Projects::SharedProject project() const;
         Models::SharedApplicationModel appModel() const;
         void addElement(Entity::KindOfType kindOfType, const QPoint &eventPos);
+        void updateStatistics();
+        QRect statisticsRect() const;
 
         Projects::WeakProject m_Project;
         Models::WeakApplicationModel m_ApplicationModel;
         Commands::SharedCommandStack m_CommandStack;
+
+        // Items count and FPS overlay
+        bool m_ShowStatistics;
+        QElapsedTimer m_FrameTimer;
+        int m_FramesCount;
+        QString m_StatisticsText;
     };
 
 } // namespace gui
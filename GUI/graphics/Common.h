@@ -22,6 +22,9 @@
 *****************************************************************************/
 #pragma once
 
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
 namespace Graphics {
 
     /// Special elements types
@@ -31,4 +34,21 @@ namespace Graphics {
         Relation = 2, ///< Relation
     };
 
+    /// How much details are drawn, depends on the zoom
+    enum class DetailLevel
+    {
+        Full, ///< All details
+        Low,  ///< Simplified shapes only, for far zoom
+    };
+
+    /// Scale below which items are drawn with low details
+    constexpr qreal lowDetailThreshold = 0.5;
+
+    /// Level of details for the item being painted
+    inline DetailLevel detailLevel(const QStyleOptionGraphicsItem *option, const QPainter *painter)
+    {
+        return option && option->levelOfDetailFromTransform(painter->worldTransform()) < lowDetailThreshold
+               ? DetailLevel::Low : DetailLevel::Full;
+    }
+
 } // namespace graphics
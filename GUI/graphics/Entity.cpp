@@ -46,12 +46,15 @@
 
 #include <Utility/helpfunctions.h>
 
+#include <Translation/signaturemaker.h>
+
 #include <Entity/Property.h>
 #include <Entity/GraphicEntityData.h>
 
 #include "Constants.h"
 #include "QtHelpers.h"
 #include "HeaderEditorEventFilter.h"
+#include "Scene.h"
 
 namespace Graphics {
 
@@ -86,8 +89,31 @@ namespace Graphics {
             return result;
         }
 
-        bool drawSectionText(QPainter * painter, const QString &text, qreal width, int flags,
-                             QPointF &topLeft, qreal &availableHeight)
+        /// Makes text which is laid out once and then drawn without shaping
+        QStaticText makeStaticText(const QString &text, const QFont &font)
+        {
+            QStaticText result(text);
+            result.setTextFormat(Qt::PlainText);
+            result.setPerformanceHint(QStaticText::AggressiveCaching);
+            result.prepare(QTransform(), font);
+
+            return result;
+        }
+
+        /// Position of the text inside of the rectangle, only vertical centering and
+        /// left or horizontal center alignments are supported
+        QPointF alignedPos(const QRectF &rect, const QSizeF &textSize, Qt::Alignment alignment)
+        {
+            qreal x = alignment.testFlag(Qt::AlignHCenter)
+                      ? rect.center().x() - textSize.width() / 2 : rect.left();
+            return {x, rect.center().y() - textSize.height() / 2};
+        }
+
+        using SectionLines = QVector<QPair<QPointF, QStaticText>>;
+
+        bool layoutSectionText(SectionLines &lines, const QString &text, const QFont &font,
+                               qreal width, Qt::Alignment alignment, QPointF &topLeft,
+                               qreal &availableHeight)
         {
             if (qFuzzyCompare(availableHeight, 0.))
                 return false;
@@ -96,7 +122,8 @@ namespace Graphics {
 
             QPointF textRectLeft(topLeft + QPointF(lineIndentFactor * margin, 0));
             QRectF textRect(textRectLeft, QSizeF(width, currentLineHeight));
-            painter->drawText(textRect, flags, text);
+            auto staticText = makeStaticText(text, font);
+            lines << qMakePair(alignedPos(textRect, staticText.size(), alignment), staticText);
 
             availableHeight -= currentLineHeight;
             topLeft.ry() += currentLineHeight;
@@ -104,41 +131,34 @@ namespace Graphics {
             return true;
         }
 
-        template <class Container>
-        void drawSection(QPainter * painter, const QString &sectionName, const Container elements,
-                         QPointF &topLeft, qreal &availableHeight, qreal width,
-                         const QColor &frameColor)
+        template <class Container, class TextMaker>
+        void layoutSection(SectionLines &lines, QVector<QLineF> &delimiters, const QFont &font,
+                           const QString &sectionName, const Container &elements,
+                           const TextMaker &makeText, QPointF &topLeft, qreal &availableHeight,
+                           qreal width)
         {
             if (qFuzzyCompare(availableHeight, 0.) || elements.isEmpty())
                 return;
 
-            painter->save();
+            // Section name
+            layoutSectionText(lines, sectionName, font, width, Qt::AlignCenter, topLeft,
+                              availableHeight);
 
-            painter->setRenderHint(QPainter::TextAntialiasing);
-
-            // Draw section name
-            drawSectionText(painter, sectionName, width, Qt::AlignCenter, topLeft, availableHeight);
-
-            // Draw section elemnts
+            // Section elemnts
+            QFontMetrics fm(font);
             for (auto &&e : elements) {
-                // TODO: full signature should be displayed, not just name like now
-                QString name(cutText(e->name(), painter->fontMetrics(), width));
-                name.prepend(Util::sectionToSymbol(e->section()) + QChar::Space);
-                if (!drawSectionText(painter, name, width, Qt::AlignLeft | Qt::AlignVCenter,
-                                     topLeft, availableHeight))
+                QString text(cutText(makeText(e), fm, width));
+                text.prepend(Util::sectionToSymbol(e->section()) + QChar::Space);
+                if (!layoutSectionText(lines, text, font, width, Qt::AlignLeft | Qt::AlignVCenter,
+                                       topLeft, availableHeight))
                     break;
             }
 
-            // Draw delimiter line
-            if (!qFuzzyCompare(availableHeight, 0.)) {
-                painter->setPen(frameColor);
-                painter->drawLine(topLeft, QPointF(topLeft.x() + width, topLeft.y()));
-            }
-
-            painter->restore();
+            // Delimiter line
+            if (!qFuzzyCompare(availableHeight, 0.))
+                delimiters << QLineF(topLeft, QPointF(topLeft.x() + width, topLeft.y()));
         }
 
-
         QGraphicsProxyWidget * makeHeaderEditor(QGraphicsScene & scene, QObject & parent,
                                                 const Entity::Type & type)
         {
@@ -206,9 +226,16 @@ namespace Graphics {
      */
     void GraphisEntity::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
     {
-        Q_UNUSED(option);
         Q_UNUSED(widget);
 
+        if (!isContentCacheValid(painter->font()))
+            updateContentCache(painter->font());
+
+        if (detailLevel(option, painter) == DetailLevel::Low) {
+            drawSimplified(painter);
+            return;
+        }
+
         drawFrame(painter);
         drawHeader(painter);
         drawSections(painter);
@@ -223,6 +250,15 @@ namespace Graphics {
         if (change == ItemPositionChange && scene() )
             emit positionChanged(pos(), value.toPointF());
 
+        // Register in the scene spatial index
+        if (change == ItemSceneChange)
+            if (auto oldScene = qobject_cast<Scene*>(scene()))
+                oldScene->removeEntity(this);
+
+        if (change == ItemSceneHasChanged)
+            if (auto newScene = qobject_cast<Scene*>(scene()))
+                newScene->addEntity(this);
+
         return QGraphicsItem::itemChange(change, value);
     }
 
@@ -308,12 +344,49 @@ namespace Graphics {
         return QRectF(-width() / 2, -height() / 2, width(), height());
     }
 
+    /**
+     * @brief GraphisEntity::size
+     * @return
+     */
+    QSizeF GraphisEntity::size() const
+    {
+        return {width(), height()};
+    }
+
+    /**
+     * @brief GraphisEntity::resize
+     * @param size
+     */
+    void GraphisEntity::resize(const QSizeF &size)
+    {
+        if (size == this->size())
+            return;
+
+        prepareGeometryChange();
+
+        setWidth(qMax(size.width(), minimumWidth));
+        setHeight(qMax(size.height(), minimumHeight));
+
+        emit sizeChanged();
+    }
+
+    /**
+     * @brief GraphisEntity::setSignatureMaker
+     * @param maker
+     */
+    void GraphisEntity::setSignatureMaker(Translation::UniqueSignatureMaker &&maker)
+    {
+        m_SignatureMaker = std::move(maker);
+        redraw();
+    }
+
     /**
      * @brief Entity::redraw
      */
     void GraphisEntity::redraw()
     {
         // TODO: add flags and update only needed elements, e.g. header
+        m_ContentCache.valid = false;
         update(boundingRect());
     }
 
@@ -326,6 +399,8 @@ namespace Graphics {
         m_LastPos = pos();
 
         m_ResizeMode = resizeCorner().containsPoint(event->pos(), Qt::OddEvenFill);
+        if (m_ResizeMode)
+            m_LastSize = size();
 
         QGraphicsItem::mousePressEvent(event);
     }
@@ -339,6 +414,9 @@ namespace Graphics {
         if (pos() != m_LastPos)
             emit moved(m_LastPos, pos());
 
+        if (m_ResizeMode && size() != m_LastSize)
+            emit resized(m_LastSize, size());
+
         m_ResizeMode = false;
 
         QGraphicsItem::mouseReleaseEvent(event);
@@ -487,6 +565,7 @@ namespace Graphics {
     void GraphisEntity::setWidth(qreal newWidth)
     {
         ged().setWidth(newWidth);
+        m_ContentCache.valid = false;
     }
 
     /**
@@ -505,6 +584,7 @@ namespace Graphics {
     void GraphisEntity::setHeight(qreal newHeight)
     {
         ged().setHeight(newHeight);
+        m_ContentCache.valid = false;
     }
 
     /**
@@ -559,9 +639,37 @@ namespace Graphics {
                          this, &GraphisEntity::redraw);
             G_DISCONNECT(this, &GraphisEntity::positionChanged,
                          G_ASSERT(data), &Entity::GraphicEntityData::onPosChanged);
+
+            watchComponents(false);
+            m_ContentCache = ContentCache();
         }
     }
 
+    /**
+     * @brief GraphisEntity::watchComponents
+     * @param watch
+     */
+    void GraphisEntity::watchComponents(bool watch)
+    {
+        // Components may be edited in place, so the cache cannot rely on the lists comparison only
+        auto apply = [&](auto &&components) {
+            for (auto &&component : components) {
+                if (watch)
+                    G_CONNECT(component.get(), &Common::BasicElement::changed,
+                              this, &GraphisEntity::redraw);
+                else
+                    G_DISCONNECT(component.get(), &Common::BasicElement::changed,
+                                 this, &GraphisEntity::redraw);
+            }
+        };
+
+        const auto &c = m_ContentCache;
+        apply(c.properties);
+        apply(c.methods);
+        apply(c.fields);
+        apply(c.enumerators);
+    }
+
     /**
      * @brief Entity::drawHeader
      * @param painter
@@ -586,8 +694,7 @@ namespace Graphics {
         // Add element name
         painter->setPen(Qt::black);
         painter->setRenderHint(QPainter::TextAntialiasing);
-        QString name(cutText(G_ASSERT(m_Type)->name(), painter->fontMetrics(), width()));
-        painter->drawText(headerRect, Qt::AlignCenter, name);
+        painter->drawStaticText(m_ContentCache.headerPos, m_ContentCache.header);
 
         painter->restore();
     }
@@ -644,17 +751,117 @@ namespace Graphics {
     {
         painter->save();
 
-        // Calculate initial parameters
-        QColor color = typeColor();
+        painter->setRenderHint(QPainter::TextAntialiasing);
+        for (auto &&line : m_ContentCache.lines)
+            painter->drawStaticText(line.first, line.second);
+
+        painter->setPen(typeColor());
+        painter->drawLines(m_ContentCache.delimiters);
+
+        painter->restore();
+    }
+
+    /**
+     * @brief GraphisEntity::componentText
+     * @param component
+     * @return full signature if signature maker is set, otherwise name
+     */
+    QString GraphisEntity::componentText(const Common::SharedBasicEntity &component)
+    {
+        return m_SignatureMaker ? m_SignatureMaker->signature(component) : component->name();
+    }
+
+    /**
+     * @brief GraphisEntity::contentLines
+     * @return text of the sections lines laid out on the last paint
+     */
+    QStringList GraphisEntity::contentLines() const
+    {
+        QStringList result;
+        for (auto &&line : m_ContentCache.lines)
+            result << line.second.text();
+
+        return result;
+    }
+
+    /**
+     * @brief GraphisEntity::isContentCacheValid
+     * @param font
+     * @return
+     */
+    bool GraphisEntity::isContentCacheValid(const QFont &font) const
+    {
+        // Lists are compared by data pointer first, so it's cheap until a component is added or removed
+        const auto &c = m_ContentCache;
+        return c.valid && c.font == font &&
+               c.properties == m_Type->properties() && c.methods == m_Type->methods() &&
+               c.fields == m_Type->fields() && c.enumerators == m_Type->enumerators();
+    }
+
+    /**
+     * @brief GraphisEntity::updateContentCache
+     * @param font
+     */
+    void GraphisEntity::updateContentCache(const QFont &font)
+    {
+        auto &c = m_ContentCache;
+
+        watchComponents(false);
+
+        c.font        = font;
+        c.properties  = m_Type->properties();
+        c.methods     = m_Type->methods();
+        c.fields      = m_Type->fields();
+        c.enumerators = m_Type->enumerators();
+
+        watchComponents(true);
+
+        c.lines.clear();
+        c.delimiters.clear();
+
+        // Header
+        c.header = makeStaticText(cutText(G_ASSERT(m_Type)->name(), QFontMetrics(font), width()), font);
+        c.headerPos = alignedPos(headerRect(), c.header.size(), Qt::AlignCenter);
+
+        // Sections
         auto topLeft = boundingRect().topLeft() + QPointF(margin, margin);
         topLeft.ry() += minimumHeight;
         qreal len = height() - minimumHeight;
 
-        // Draw sections
-        drawSection(painter, tr("Properties"), m_Type->properties(), topLeft, len, width(), color);
-        drawSection(painter, tr("Methods"), m_Type->methods(), topLeft, len, width(), color);
-        drawSection(painter, tr("Fields"), m_Type->fields(), topLeft, len, width(), color);
-        drawSection(painter, tr("Elements"), m_Type->enumerators(), topLeft, len, width(), color);
+        auto signature = [&](auto &&e) { return componentText(e); };
+        auto name = [](auto &&e) { return e->name(); };
+
+        layoutSection(c.lines, c.delimiters, font, tr("Properties"), c.properties, signature,
+                      topLeft, len, width());
+        layoutSection(c.lines, c.delimiters, font, tr("Methods"), c.methods, signature,
+                      topLeft, len, width());
+        layoutSection(c.lines, c.delimiters, font, tr("Fields"), c.fields, signature,
+                      topLeft, len, width());
+        layoutSection(c.lines, c.delimiters, font, tr("Elements"), c.enumerators, name,
+                      topLeft, len, width());
+
+        c.valid = true;
+    }
+
+    /**
+     * @brief GraphisEntity::drawSimplified
+     * @param painter
+     */
+    void GraphisEntity::drawSimplified(QPainter *painter)
+    {
+        painter->save();
+
+        QRectF rect(frameRect());
+        painter->setPen(currentPen());
+        painter->setBrush(typeColor());
+        painter->drawRect(rect);
+
+        painter->setPen(Qt::black);
+        const auto &name = m_ContentCache.header;
+        painter->drawStaticText(alignedPos(rect, name.size(), Qt::AlignCenter), name);
+
+        if (selectedToConnect())
+            drawConnectFrame(painter);
 
         painter->restore();
     }
@@ -26,11 +26,16 @@
 
 #include <QGraphicsObject>
 #include <QPointer>
+#include <QStaticText>
+
+#include <Common/CommonTypes.hpp>
 
 #include <Entity/EntityTypes.hpp>
 
 #include <Project/ProjectTypes.hpp>
 
+#include <Translation/translator_types.hpp>
+
 #include "Common.h"
 
 QT_BEGIN_NAMESPACE
@@ -69,12 +74,20 @@ namespace Graphics {
         static qreal rectMargin();
         QRectF frameRect() const;
 
+        QSizeF size() const;
+        void resize(const QSizeF &size);
+
+        void setSignatureMaker(Translation::UniqueSignatureMaker &&maker);
+
+        QStringList contentLines() const;
+
     signals:
         void moved(const QPointF &from, const QPointF &to);
         void positionChanged(const QPointF &from, const QPointF &to);
         void heightChanged(qreal height);
         void widthChanged(qreal width);
         void sizeChanged();
+        void resized(const QSizeF &from, const QSizeF &to);
 
     public slots:
         void redraw();
@@ -109,18 +122,46 @@ namespace Graphics {
         QLineEdit *nameEditorWgt();
 
         void connect(bool connect = true);
+        void watchComponents(bool watch);
 
         void drawHeader(QPainter * painter);
         void drawFrame(QPainter * painter);
         void drawResizeCorner(QPainter * painter);
         void drawSections(QPainter * painter);
         void drawConnectFrame(QPainter * painter);
+        void drawSimplified(QPainter * painter);
+
+        QString componentText(const Common::SharedBasicEntity &component);
+        bool isContentCacheValid(const QFont &font) const;
+        void updateContentCache(const QFont &font);
+
+        /// Laid out text of the header and sections, rebuilt only when content, name or size change
+        struct ContentCache
+        {
+            bool valid = false;
+            QFont font;
+
+            // Shallow copies, comparison is cheap while the lists are not modified
+            Entity::PropertiesList properties;
+            Entity::MethodsList methods;
+            Entity::FieldsList fields;
+            Entity::Enumerators enumerators;
+
+            QStaticText header;
+            QPointF headerPos;
+            QVector<QPair<QPointF, QStaticText>> lines;
+            QVector<QLineF> delimiters;
+        };
 
         Entity::SharedType m_Type;
         QPointF m_LastPos;
+        QSizeF m_LastSize;
         bool m_ResizeMode;
         bool m_selectedToConnect;
 
+        Translation::UniqueSignatureMaker m_SignatureMaker;
+        ContentCache m_ContentCache;
+
         QPointer<QGraphicsProxyWidget> m_NameEditor;
     };
 
@@ -29,8 +29,10 @@
 
 #include <Relationship/Relation.h>
 
+#include "Common.h"
 #include "Entity.h"
 #include "QtHelpers.h"
+#include "Scene.h"
 #include "enums.h"
 
 namespace Graphics {
@@ -196,8 +198,14 @@ namespace Graphics {
      * @param option
      * @param widget
      */
-    void Relation::paint(QPainter *painter, const QStyleOptionGraphicsItem */*option*/, QWidget */*widget*/)
+    void Relation::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget */*widget*/)
     {
+        // Arrows are not distinguishable on far zoom, plain line is enough
+        if (detailLevel(option, painter) == DetailLevel::Low) {
+            painter->drawLine(line());
+            return;
+        }
+
         painter->save();
         painter->setRenderHint(QPainter::Antialiasing);
 
@@ -236,8 +244,8 @@ namespace Graphics {
     {
         if (e) {
             recalculateLine();
-            G_CONNECT(e.data(), &GraphisEntity::positionChanged, this, &Relation::recalculateLine);
-            G_CONNECT(e.data(), &GraphisEntity::sizeChanged, this, &Relation::recalculateLine);
+            G_CONNECT(e.data(), &GraphisEntity::positionChanged, this, &Relation::scheduleRecalculation);
+            G_CONNECT(e.data(), &GraphisEntity::sizeChanged, this, &Relation::scheduleRecalculation);
         }
     }
 
@@ -249,8 +257,8 @@ namespace Graphics {
     void Relation::setEntity(EntityPtr &e, const EntityPtr &newEntity)
     {
         if (e) {
-            G_DISCONNECT(e.data(), &GraphisEntity::positionChanged, this, &Relation::recalculateLine);
-            G_DISCONNECT(e.data(), &GraphisEntity::sizeChanged, this, &Relation::recalculateLine);
+            G_DISCONNECT(e.data(), &GraphisEntity::positionChanged, this, &Relation::scheduleRecalculation);
+            G_DISCONNECT(e.data(), &GraphisEntity::sizeChanged, this, &Relation::scheduleRecalculation);
         }
 
         e = newEntity;
@@ -302,6 +310,18 @@ namespace Graphics {
         return m_From;
     }
 
+    /**
+     * @brief Relation::scheduleRecalculation
+     */
+    void Relation::scheduleRecalculation()
+    {
+        // Scene recalculates all changed relations at once, e.g. when a selection is dragged
+        if (auto s = qobject_cast<Scene*>(scene()))
+            s->scheduleRelationUpdate(this);
+        else
+            recalculateLine();
+    }
+
     /**
      * @brief Relation::recalculateLine
      */
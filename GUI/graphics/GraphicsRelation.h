@@ -57,9 +57,12 @@ namespace Graphics {
 
         Common::ID id() const;
 
-    private slots:
+    public slots:
         void recalculateLine();
 
+    private slots:
+        void scheduleRecalculation();
+
     private:
         void initEntity(const EntityPtr &e);
         void setEntity(EntityPtr &e, const EntityPtr &newEntity);
@@ -29,9 +29,12 @@
 #include <QDebug>
 
 #include <Commands/AddRelation.h>
+#include <Commands/MoveGraphicObject.h>
+#include <Commands/ResizeGraphicEntity.h>
 #include <Project/Project.h>
 
 #include "Entity.h"
+#include "GraphicsRelation.h"
 #include "QtHelpers.h"
 
 namespace Graphics {
@@ -56,14 +59,6 @@ namespace Graphics {
             int type() const override { return Type; }
         };
 
-        inline GraphisEntity * entElem(const Scene * scene, const QPointF &pos)
-        {
-            if (auto item = scene->itemAt(pos, QTransform()))
-                return qgraphicsitem_cast<GraphisEntity*>(item);
-
-            return nullptr;
-        }
-
         inline void setTrackedItemStatus(QPointer<GraphisEntity> &e, bool status, bool update = true)
         {
             if (!e.isNull()) {
@@ -88,6 +83,7 @@ namespace Graphics {
         , m_activeRelationType(Relationship::SimpleRelation)
         , m_RelationTrackLine(nullptr)
         , m_CommandStack(std::move(cs))
+        , m_UpdatesScheduled(false)
     {
         initTrackLine();
         makeConnections();
@@ -117,6 +113,107 @@ namespace Graphics {
         return m_ShowRelationTrack;
     }
 
+    /**
+     * @brief Scene::addEntity
+     * @param entity
+     */
+    void Scene::addEntity(GraphisEntity *entity)
+    {
+        G_ASSERT(entity);
+
+        // Position isn't final while loading, so put the entity to the grid later
+        if (isBulkLoading())
+            m_DirtyEntities.insert(entity, entity);
+        else
+            m_EntitiesGrid.insert(entity, entity->sceneBoundingRect());
+
+        connect(entity, &GraphisEntity::positionChanged, this, &Scene::onEntityGeometryChanged,
+                Qt::UniqueConnection);
+        connect(entity, &GraphisEntity::sizeChanged, this, &Scene::onEntityGeometryChanged,
+                Qt::UniqueConnection);
+        connect(entity, &QObject::destroyed, this, &Scene::onEntityDestroyed, Qt::UniqueConnection);
+        connect(entity, &GraphisEntity::resized, this, &Scene::onEntityResized, Qt::UniqueConnection);
+    }
+
+    /**
+     * @brief Scene::removeEntity
+     * @param entity
+     */
+    void Scene::removeEntity(GraphisEntity *entity)
+    {
+        G_ASSERT(entity);
+
+        m_EntitiesGrid.remove(entity);
+        m_DirtyEntities.remove(entity);
+
+        disconnect(entity, &GraphisEntity::positionChanged, this, &Scene::onEntityGeometryChanged);
+        disconnect(entity, &GraphisEntity::sizeChanged, this, &Scene::onEntityGeometryChanged);
+        disconnect(entity, &QObject::destroyed, this, &Scene::onEntityDestroyed);
+        disconnect(entity, &GraphisEntity::resized, this, &Scene::onEntityResized);
+    }
+
+    /**
+     * @brief Scene::entityAt
+     * @param pos
+     * @return top-most entity under the point
+     */
+    GraphisEntity *Scene::entityAt(const QPointF &pos)
+    {
+        updateEntitiesGrid();
+
+        GraphisEntity *result = nullptr;
+        for (auto &&entity : m_EntitiesGrid.candidates(pos))
+            if (entity->isVisible() && entity->contains(entity->mapFromScene(pos)))
+                if (!result || entity->zValue() > result->zValue())
+                    result = entity;
+
+        return result;
+    }
+
+    /**
+     * @brief Scene::scheduleRelationUpdate
+     * @param relation
+     */
+    void Scene::scheduleRelationUpdate(Relation *relation)
+    {
+        m_DirtyRelations.insert(G_ASSERT(relation), relation);
+        scheduleUpdates();
+    }
+
+    /**
+     * @brief Scene::beginBulkLoad
+     */
+    void Scene::beginBulkLoad()
+    {
+        if (m_BulkLoadDepth++ == 0) {
+            m_BulkLoadIndexMethod = itemIndexMethod();
+            setItemIndexMethod(NoIndex);
+        }
+    }
+
+    /**
+     * @brief Scene::endBulkLoad
+     */
+    void Scene::endBulkLoad()
+    {
+        Q_ASSERT(m_BulkLoadDepth > 0);
+        if (--m_BulkLoadDepth > 0)
+            return;
+
+        setItemIndexMethod(m_BulkLoadIndexMethod);
+        updateEntitiesGrid();
+        scheduleUpdates();
+    }
+
+    /**
+     * @brief Scene::isBulkLoading
+     * @return
+     */
+    bool Scene::isBulkLoading() const
+    {
+        return m_BulkLoadDepth > 0;
+    }
+
     /**
      * @brief Scene::mousePressEvent
      * @param event
@@ -126,7 +223,7 @@ namespace Graphics {
         if (showRelationTrack()) {
 
             QPointF scenePos = event->scenePos();
-            if (auto elem = entElem(this, scenePos)) {
+            if (auto elem = entityAt(scenePos)) {
 
                 // Preserve and mark as selected first element
                 m_TrackFrom = elem;
@@ -145,6 +242,10 @@ namespace Graphics {
         }
 
         QGraphicsScene::mousePressEvent(event);
+
+        // Selection is already updated by the item under the cursor
+        ++m_MoveGesture;
+        rememberSelectionPositions();
     }
 
     /**
@@ -157,7 +258,7 @@ namespace Graphics {
 
             // Check an element under the cursor
             QPointF scenePos = event->scenePos();
-            if (auto elem = entElem(this, scenePos)) {
+            if (auto elem = entityAt(scenePos)) {
                 // Setup second element
                 if (elem != m_TrackFrom && elem != m_TrackTo) {
                     setTrackedItemStatus(m_TrackTo, false /*status*/, true /*update*/);
@@ -221,6 +322,8 @@ namespace Graphics {
         }
 
         QGraphicsScene::mouseReleaseEvent(event);
+
+        pushMoveCommand();
     }
 
     /**
@@ -264,6 +367,122 @@ namespace Graphics {
         emit selectedItemsChanged(items);
     }
 
+    /**
+     * @brief Scene::onEntityGeometryChanged
+     */
+    void Scene::onEntityGeometryChanged()
+    {
+        if (auto entity = qobject_cast<GraphisEntity*>(sender())) {
+            m_DirtyEntities.insert(entity, entity);
+            scheduleUpdates();
+        }
+    }
+
+    /**
+     * @brief Scene::onEntityDestroyed
+     * @param entity
+     */
+    void Scene::onEntityDestroyed(QObject *entity)
+    {
+        // Object is already partially destroyed, so the pointer is used only as a key
+        auto e = static_cast<GraphisEntity*>(entity);
+        m_EntitiesGrid.remove(e);
+        m_DirtyEntities.remove(e);
+    }
+
+    /**
+     * @brief Scene::onEntityResized
+     * @param from
+     * @param to
+     */
+    void Scene::onEntityResized(const QSizeF &from, const QSizeF &to)
+    {
+        if (auto entity = qobject_cast<GraphisEntity*>(sender())) {
+            auto cmd = Commands::make<Commands::ResizeGraphicEntity>(
+                           *entity, G_ASSERT(entity->typeObject())->name(), from, to);
+            G_ASSERT(m_CommandStack)->push(cmd.release());
+        }
+    }
+
+    /**
+     * @brief Scene::processPendingUpdates
+     */
+    void Scene::processPendingUpdates()
+    {
+        m_UpdatesScheduled = false;
+
+        // Will be scheduled again at the end of bulk load
+        if (isBulkLoading())
+            return;
+
+        updateEntitiesGrid();
+
+        auto relations = std::move(m_DirtyRelations);
+        m_DirtyRelations.clear();
+        for (auto &&relation : relations)
+            if (relation)
+                relation->recalculateLine();
+    }
+
+    /**
+     * @brief Scene::scheduleUpdates
+     */
+    void Scene::scheduleUpdates()
+    {
+        if (m_UpdatesScheduled)
+            return;
+
+        // Queued call is processed before the scene repaints changed items
+        m_UpdatesScheduled = true;
+        QMetaObject::invokeMethod(this, "processPendingUpdates", Qt::QueuedConnection);
+    }
+
+    /**
+     * @brief Scene::updateEntitiesGrid
+     */
+    void Scene::updateEntitiesGrid()
+    {
+        for (auto &&entity : m_DirtyEntities)
+            if (entity)
+                m_EntitiesGrid.insert(entity, entity->sceneBoundingRect());
+
+        m_DirtyEntities.clear();
+    }
+
+    /**
+     * @brief Scene::rememberSelectionPositions
+     */
+    void Scene::rememberSelectionPositions()
+    {
+        m_MoveStartPositions.clear();
+        for (auto &&item : selectedItems())
+            if (auto entity = qgraphicsitem_cast<GraphisEntity*>(item))
+                m_MoveStartPositions << qMakePair(EntityPtr(entity), entity->pos());
+    }
+
+    /**
+     * @brief Scene::pushMoveCommand
+     */
+    void Scene::pushMoveCommand()
+    {
+        // All selected entities are moved together, so make a single undo step for them
+        Commands::MoveGraphicObject::Moves moves;
+        QString name;
+        for (auto &&p : m_MoveStartPositions) {
+            if (p.first && p.first->pos() != p.second) {
+                moves.append({p.first, p.second, p.first->pos()});
+                name = G_ASSERT(p.first->typeObject())->name();
+            }
+        }
+        m_MoveStartPositions.clear();
+
+        if (moves.isEmpty())
+            return;
+
+        auto cmd = Commands::make<Commands::MoveGraphicObject>(moves, name, m_MoveGesture);
+        G_ASSERT(m_CommandStack)->push(cmd.release());
+    }
+
     /**
      * @brief Scene::pr
      * @return
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <QGraphicsScene>
+#include <QHash>
 #include <QPointer>
 
 #include <Commands/CommandsTypes.h>
@@ -32,11 +33,11 @@
 #include <Entity/EntityTypes.hpp>
 
 #include "enums.h"
+#include "GraphicsTypes.h"
+#include "SpatialGrid.h"
 
 namespace Graphics {
 
-    class GraphisEntity;
-
     /// The main scene
     class Scene : public QGraphicsScene
     {
@@ -53,6 +54,16 @@ namespace Graphics {
 
         static int elementTypeKey();
 
+        void addEntity(GraphisEntity *entity);
+        void removeEntity(GraphisEntity *entity);
+        GraphisEntity *entityAt(const QPointF &pos);
+
+        void scheduleRelationUpdate(Relation *relation);
+
+        void beginBulkLoad();
+        void endBulkLoad();
+        bool isBulkLoading() const;
+
     public: // QGraphicsScene overrides
         void mousePressEvent(QGraphicsSceneMouseEvent *event) override;
         void mouseMoveEvent(QGraphicsSceneMouseEvent *event) override;
@@ -69,10 +80,18 @@ namespace Graphics {
 
     private slots:
         void onSelectionChanged();
+        void onEntityGeometryChanged();
+        void onEntityDestroyed(QObject *entity);
+        void onEntityResized(const QSizeF &from, const QSizeF &to);
+        void processPendingUpdates();
 
     private: // Methods
         Projects::SharedProject pr() const;
         void makeConnections();
+        void scheduleUpdates();
+        void updateEntitiesGrid();
+        void rememberSelectionPositions();
+        void pushMoveCommand();
 
     private: // Data
         bool m_ShowRelationTrack;
@@ -87,6 +106,21 @@ namespace Graphics {
         Projects::WeakProject m_Project;
 
         Commands::SharedCommandStack m_CommandStack;
+
+        // Geometry changes are processed once per event loop iteration
+        SpatialGrid m_EntitiesGrid;
+        QHash<GraphisEntity*, EntityPtr> m_DirtyEntities;
+        QHash<Relation*, RelationPtr> m_DirtyRelations;
+        bool m_UpdatesScheduled;
+
+        // Positions of the selected entities before dragging
+        QVector<QPair<EntityPtr, QPointF>> m_MoveStartPositions;
+        // Incremented on each mouse press, moves are merged only within one gesture
+        int m_MoveGesture = 0;
+
+        // Items index is rebuilt once at the end of bulk load
+        int m_BulkLoadDepth = 0;
+        ItemIndexMethod m_BulkLoadIndexMethod = BspTreeIndex;
     };
 
 } // namespace grphics
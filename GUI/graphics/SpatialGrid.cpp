@@ -0,0 +1,149 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "SpatialGrid.h"
+
+#include <cmath>
+
+namespace Graphics {
+
+    /**
+     * @brief SpatialGrid::SpatialGrid
+     * @param cellSize
+     */
+    SpatialGrid::SpatialGrid(qreal cellSize)
+        : m_CellSize(cellSize)
+    {
+        Q_ASSERT(m_CellSize > 0);
+    }
+
+    /**
+     * @brief SpatialGrid::insert
+     * @param entity
+     * @param rect scene rect of the entity, previous one is replaced
+     */
+    void SpatialGrid::insert(GraphisEntity *entity, const QRectF &rect)
+    {
+        QRect range(cellsRange(rect));
+        if (auto it = m_Ranges.constFind(entity); it != m_Ranges.cend()) {
+            if (*it == range)
+                return;
+
+            remove(entity);
+        }
+
+        for (int x = range.left(); x <= range.right(); ++x)
+            for (int y = range.top(); y <= range.bottom(); ++y)
+                m_Cells[key(x, y)] << entity;
+
+        m_Ranges[entity] = range;
+    }
+
+    /**
+     * @brief SpatialGrid::remove
+     * @param entity
+     */
+    void SpatialGrid::remove(GraphisEntity *entity)
+    {
+        auto it = m_Ranges.find(entity);
+        if (it == m_Ranges.end())
+            return;
+
+        const QRect range(*it);
+        for (int x = range.left(); x <= range.right(); ++x) {
+            for (int y = range.top(); y <= range.bottom(); ++y) {
+                auto cell = m_Cells.find(key(x, y));
+                if (cell == m_Cells.end())
+                    continue;
+
+                cell->removeOne(entity);
+                if (cell->isEmpty())
+                    m_Cells.erase(cell);
+            }
+        }
+
+        m_Ranges.erase(it);
+    }
+
+    /**
+     * @brief SpatialGrid::clear
+     */
+    void SpatialGrid::clear()
+    {
+        m_Cells.clear();
+        m_Ranges.clear();
+    }
+
+    /**
+     * @brief SpatialGrid::candidates
+     * @param pos
+     * @return entities which rects may contain the point
+     */
+    QVector<GraphisEntity *> SpatialGrid::candidates(const QPointF &pos) const
+    {
+        return m_Cells.value(key(int(std::floor(pos.x() / m_CellSize)),
+                                 int(std::floor(pos.y() / m_CellSize))));
+    }
+
+    /**
+     * @brief SpatialGrid::count
+     * @return
+     */
+    int SpatialGrid::count() const
+    {
+        return m_Ranges.count();
+    }
+
+    /**
+     * @brief SpatialGrid::cellSize
+     * @return
+     */
+    qreal SpatialGrid::cellSize() const
+    {
+        return m_CellSize;
+    }
+
+    /**
+     * @brief SpatialGrid::cellsRange
+     * @param rect
+     * @return
+     */
+    QRect SpatialGrid::cellsRange(const QRectF &rect) const
+    {
+        return QRect(QPoint(int(std::floor(rect.left()  / m_CellSize)),
+                            int(std::floor(rect.top()   / m_CellSize))),
+                     QPoint(int(std::floor(rect.right() / m_CellSize)),
+                            int(std::floor(rect.bottom()/ m_CellSize))));
+    }
+
+    /**
+     * @brief SpatialGrid::key
+     * @param x
+     * @param y
+     * @return
+     */
+    SpatialGrid::CellKey SpatialGrid::key(int x, int y)
+    {
+        return (CellKey(quint32(x)) << 32) | quint32(y);
+    }
+
+} // namespace graphics
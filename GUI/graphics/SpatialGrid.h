@@ -0,0 +1,60 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QHash>
+#include <QRect>
+#include <QRectF>
+#include <QVector>
+
+namespace Graphics {
+
+    class GraphisEntity;
+
+    /// Uniform grid of entities bounding rects, used for hit-testing on mouse moves
+    class SpatialGrid
+    {
+    public:
+        explicit SpatialGrid(qreal cellSize = 256.);
+
+        void insert(GraphisEntity *entity, const QRectF &rect);
+        void remove(GraphisEntity *entity);
+        void clear();
+
+        QVector<GraphisEntity *> candidates(const QPointF &pos) const;
+
+        int count() const;
+        qreal cellSize() const;
+
+    private:
+        using CellKey = quint64;
+
+        QRect cellsRange(const QRectF &rect) const;
+        static CellKey key(int x, int y);
+
+        qreal m_CellSize;
+        QHash<CellKey, QVector<GraphisEntity *>> m_Cells;
+        QHash<GraphisEntity *, QRect> m_Ranges;
+    };
+
+} // namespace graphics
@@ -26,6 +26,8 @@
 #include <QFileInfo>
 #include <QDebug>
 
+#include <Translation/translationsession.h>
+
 namespace Generator {
 
     /**
@@ -182,7 +184,14 @@ namespace Generator {
      */
     void AbstractProjectGenerator::generate()
     {
+        // Lookups are memoised only for the duration of one run, databases may change later
+        auto previousSession = m_ProjectTranslator.session();
+        m_LastSession = std::make_shared<Translation::TranslationSession>();
+        m_ProjectTranslator.setSession(m_LastSession);
+
         doGenerate();
+
+        m_ProjectTranslator.setSession(previousSession);
     }
 
     /**
@@ -193,4 +202,13 @@ namespace Generator {
         doWrite();
     }
 
+    /**
+     * @brief AbstractProjectGenerator::lastSession
+     * @return translation session of the last generate() call, if any
+     */
+    Translation::SharedTranslationSession AbstractProjectGenerator::lastSession() const
+    {
+        return m_LastSession;
+    }
+
 } // namespace generator
@@ -45,6 +45,8 @@ namespace Generator {
             NoOptions = 0x0,
             NamespacesInSubfolders = 0x1,
             DefineIcludeGuard = 0x2, // pragma by default
+            ParallelGeneration = 0x4, // translate types on the global thread pool
+            IncrementalGeneration = 0x8, // skip types which are not changed since the last run
         };
         Q_DECLARE_FLAGS(GeneratorOptions, GeneratorOption)
 
@@ -75,6 +77,8 @@ namespace Generator {
        void generate();
        void writeToDisk() const;
 
+       Translation::SharedTranslationSession lastSession() const;
+
     protected:
        virtual void doGenerate() = 0;
        virtual void doWrite() const = 0;
@@ -84,6 +88,7 @@ namespace Generator {
        QString m_OutputDirectory;
        QString m_ProjectName;
        mutable SharedErrorList m_ErrorList;
+       Translation::SharedTranslationSession m_LastSession;
     };
 
     Q_DECLARE_OPERATORS_FOR_FLAGS(AbstractProjectGenerator::GeneratorOptions)
@@ -28,6 +28,16 @@
 #include "templates.cpp"
 
 #include <QMap>
+#include <QSet>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QCryptographicHash>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <functional>
 
 #include <DB/Database.h>
 #include <DB/ProjectDatabase.h>
@@ -37,11 +47,82 @@
 #include <Entity/Enum.h>
 #include <Entity/Union.h>
 #include <Entity/TemplateClass.h>
+#include <Entity/TemplateClassMethod.h>
 #include <Entity/ExtendedType.h>
+#include <Entity/ClassMethod.h>
+#include <Entity/Property.h>
+#include <Entity/field.h>
 #include <Translation/code.h>
+#include <Translation/codebuilder.h>
+#include <Utility/helpfunctions.h>
 
 namespace Generator {
 
+    namespace {
+
+        void addExtendedTypeIDs(const Entity::ExtendedType &type, QSet<quint64> &ids)
+        {
+            ids << type.typeId().value();
+            for (auto &&id : type.templateParameters())
+                ids << id.value();
+        }
+
+        void addTemplateIDs(const Entity::Template &t, QSet<quint64> &ids)
+        {
+            for (auto &&parameter : t.templateParameters())
+                ids << parameter.first.value() << parameter.second.value();
+
+            // Local types are a part of the type data, but they refer to other types as well
+            for (auto &&type : t.localTypes())
+                if (auto et = std::dynamic_pointer_cast<Entity::ExtendedType>(type))
+                    addExtendedTypeIDs(*et, ids);
+        }
+
+        void addFieldsIDs(const Entity::FieldsList &fields, QSet<quint64> &ids)
+        {
+            for (auto &&field : fields)
+                ids << field->typeId().value();
+        }
+
+        /// IDs of the types which are referred by the type components
+        QSet<quint64> usedIDs(const Entity::SharedType &type)
+        {
+            QSet<quint64> result;
+
+            if (auto cls = std::dynamic_pointer_cast<Entity::Class>(type)) {
+                for (auto &&parent : cls->parents())
+                    result << parent.first.value();
+
+                for (auto &&method : cls->methods()) {
+                    result << method->returnTypeId().value();
+                    addFieldsIDs(method->parameters(), result);
+                    if (auto tm = std::dynamic_pointer_cast<Entity::TemplateClassMethod>(method))
+                        addTemplateIDs(*tm, result);
+                }
+
+                addFieldsIDs(cls->fields(), result);
+
+                for (auto &&property : cls->properties())
+                    result << property->typeId().value();
+
+                if (auto tc = std::dynamic_pointer_cast<Entity::TemplateClass>(cls))
+                    addTemplateIDs(*tc, result);
+            } else if (auto u = std::dynamic_pointer_cast<Entity::Union>(type)) {
+                addFieldsIDs(u->fields(), result);
+            } else if (auto e = std::dynamic_pointer_cast<Entity::Enum>(type)) {
+                result << e->enumTypeId().value();
+            } else if (auto et = std::dynamic_pointer_cast<Entity::ExtendedType>(type)) {
+                addExtendedTypeIDs(*et, result);
+            }
+
+            result.remove(Common::ID::nullID().value());
+            result.remove(type->id().value());
+
+            return result;
+        }
+
+    } // namespace
+
     /**
      * @brief BasicCppProjectGenerator::BasicCppProjectGenerator
      */
@@ -76,6 +157,16 @@ namespace Generator {
         if (m_ErrorList && !m_ErrorList->isEmpty()) {
             m_RootOutputDirectory->clearVirtualStructure();
             m_RootOutputDirectory->addFile("errors.log")->setData(m_ErrorList->join("\n"));
+            return;
+        }
+
+        if (m_Options & IncrementalGeneration) {
+            const QDir dir(m_OutputDirectory);
+            for (auto &&file : m_StaleFiles)
+                QFile::remove(dir.filePath(file));
+
+            if (!m_Manifest.save(m_OutputDirectory))
+                *m_ErrorList << QObject::tr("Cannot save generation manifest.");
         }
     }
 
@@ -84,58 +175,225 @@ namespace Generator {
      */
     void BasicCppProjectGenerator::doGenerate()
     {
+        // Directories are created in the same order as in the serial mode
+        GenerationTasks tasks;
         for (auto &&scope : m_ProjectTranslator.projectDatabase()->scopes())
-            generateFiles(scope, m_RootOutputDirectory);
+            collectTasks(scope, m_RootOutputDirectory, tasks);
+
+        const bool incremental = m_Options & IncrementalGeneration;
+        if (incremental) {
+            m_Manifest.load(m_OutputDirectory);
+            for (auto &&task : tasks) {
+                task.inputHash = inputHash(task);
+                task.upToDate = m_Manifest.isUpToDate(task.type->id(), task.inputHash,
+                                                      m_OutputDirectory);
+            }
+        }
+
+        if (m_Options & ParallelGeneration) {
+            // Translation is read-only over the model: it neither modifies entities nor
+            // emits their signals. Lazily loaded types are created here, on the owner thread
+            if (auto globalDb = m_ProjectTranslator.globalDatabase())
+                globalDb->materialize();
+            if (auto projectDb = m_ProjectTranslator.projectDatabase())
+                projectDb->materialize();
+
+            QtConcurrent::blockingMap(tasks, [this](GenerationTask &task) {
+                if (!task.upToDate)
+                    task.code = generateCode(task);
+            });
+        } else {
+            for (auto &&task : tasks)
+                if (!task.upToDate)
+                    task.code = generateCode(task);
+        }
+
+        QSet<Common::ID> ids;
+        QStringList oldFiles, newFiles;
+        for (auto &&task : tasks) {
+            const auto id = task.type->id();
+            ids << id;
+
+            if (task.upToDate) {
+                // Files are already on the disk, only profile should know about them
+                const auto entry = m_Manifest.entry(id);
+                for (auto &&h : entry.headers)
+                    m_ProfileData.headers << QFileInfo(h).fileName();
+                for (auto &&s : entry.sources)
+                    m_ProfileData.sources << QFileInfo(s).fileName();
+                newFiles << entry.headers << entry.sources;
+                continue;
+            }
+
+            auto entry = addFiles(task);
+            if (incremental) {
+                const auto old = m_Manifest.entry(id);
+                oldFiles << old.headers << old.sources;
+                newFiles << entry.headers << entry.sources;
+                m_Manifest.setEntry(id, entry);
+            }
+        }
+
+        if (incremental) {
+            // Files of removed or renamed types
+            for (auto &&stale : m_Manifest.removeStale(ids))
+                oldFiles << stale.headers << stale.sources;
+
+            const auto actual = newFiles.toSet();
+            m_StaleFiles.clear();
+            for (auto &&file : oldFiles)
+                if (!actual.contains(file))
+                    m_StaleFiles << file;
+        }
 
         addProfile();
     }
 
     /**
-     * @brief BasicCppProjectGenerator::generateFiles
+     * @brief BasicCppProjectGenerator::collectTasks
      * @param scope
      * @param directory
+     * @param tasks
      */
-    void BasicCppProjectGenerator::generateFiles(const Entity::SharedScope &scope,
-                                                 const SharedVirtualDirectory &directory)
+    void BasicCppProjectGenerator::collectTasks(const Entity::SharedScope &scope,
+                                                const SharedVirtualDirectory &directory,
+                                                GenerationTasks &tasks) const
     {
         SharedVirtualDirectory dir((m_Options & NamespacesInSubfolders) ?
                                        directory->addDirectory(scope->name().toLower()) : directory);
 
-        for (auto &&t : scope->types()) {
-            Translation::Code code = m_ProjectTranslator.translate(t);
-            m_ProjectTranslator.addNamespace(t, code);
+        for (auto &&t : scope->types())
+            tasks << GenerationTask{t, scope, dir, Translation::Code()};
+
+        for (auto &&s : scope->scopes())
+            collectTasks(s, dir, tasks);
+    }
+
+    /**
+     * @brief BasicCppProjectGenerator::generateCode
+     * @param task
+     * @return
+     */
+    Translation::Code BasicCppProjectGenerator::generateCode(const GenerationTask &task) const
+    {
+        const auto &t = task.type;
+
+        Translation::Code code = m_ProjectTranslator.translate(t);
+        m_ProjectTranslator.addNamespace(t, code);
+
+        QString name(t->name().toLower());
+        if (!code.toSource.isEmpty()) {
+            Translation::CodeBuilder source;
+            source.writeRaw(QString("#include \"%1.h\"\n\n").arg(name))
+                  .writeRaw(code.toSource);
+            code.toSource = source.build();
+        }
+
+        if (!code.toHeader.isEmpty()) {
+            Translation::CodeBuilder header;
+            if (m_Options & DefineIcludeGuard) {
+                QString guardName = task.scope->name().toUpper() + "_" + t->name().toUpper() + "_H";
+                header.writeRaw("#ifndef "  + guardName + "\n")
+                      .writeRaw("#define "  + guardName + "\n\n")
+                      .writeRaw(code.toHeader)
+                      .writeRaw("\n\n#endif // " + guardName);
+            } else {
+                header.writeRaw("#pragma once\n\n")
+                      .writeRaw(code.toHeader);
+            }
+            code.toHeader = header.build();
+        }
+
+        return code;
+    }
+
+    /**
+     * @brief BasicCppProjectGenerator::inputHash
+     * @param task
+     * @return
+     */
+    QByteArray BasicCppProjectGenerator::inputHash(const GenerationTask &task) const
+    {
+        const auto globalDb = m_ProjectTranslator.globalDatabase();
+        const auto projectDb = m_ProjectTranslator.projectDatabase();
+
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+
+        // Everything what affects a file name or content
+        hash.addData(QByteArray::number(int(m_Options & ~ParallelGeneration)));
+        hash.addData(task.directory->path().toUtf8());
+        hash.addData(task.scope->name().toUtf8());
+        hash.addData(Util::scopesNamesList(task.type, projectDb).join("::").toUtf8());
 
-            QString name(t->name().toLower());
-            if (!code.toSource.isEmpty()) {
-                  code.toSource.prepend(QString("#include \"%1.h\"\n\n").arg(name));
+        const QJsonObject json = task.type->toJson();
+        hash.addData(QJsonDocument(json).toJson(QJsonDocument::Compact));
+
+        // Signatures of the used types are placed into the code, so they are dependencies too
+        QList<quint64> ids = usedIDs(task.type).toList();
+        std::sort(ids.begin(), ids.end());
+
+        QSet<quint64> visited;
+        std::function<void(const Common::ID &)> addDependency = [&](const Common::ID &id) {
+            if (visited.contains(id.value()))
+                return;
+            visited << id.value();
+
+            auto t = Util::findType(id, projectDb, globalDb);
+            if (!t) {
+                hash.addData(id.toString().toUtf8());
+                return;
             }
 
-            if (!code.toHeader.isEmpty()) {
-                if (m_Options & DefineIcludeGuard) {
-                    QString guardName = scope->name().toUpper() + "_" + t->name().toUpper() + "_H";
-                    code.toHeader.prepend("#define "  + guardName + "\n\n");
-                    code.toHeader.prepend("#ifndef "  + guardName + "\n");
-                    code.toHeader.append("\n\n#endif // " + guardName);
-                } else {
-                    code.toHeader.prepend("#pragma once\n\n");
+            hash.addData(QByteArray::number(int(t->kindOfType())));
+            hash.addData(t->name().toUtf8());
+            hash.addData(Util::scopesNamesList(t, projectDb).join("::").toUtf8());
+
+            // Modifiers, base type and template parameters form the rendered name
+            if (auto et = std::dynamic_pointer_cast<Entity::ExtendedType>(t)) {
+                hash.addData(QByteArray::number(int(et->isConst())));
+                hash.addData(QByteArray::number(int(et->useAlias())));
+                for (auto &&pl : et->pl()) {
+                    hash.addData(pl.first.toUtf8());
+                    hash.addData(QByteArray::number(int(pl.second)));
                 }
+
+                addDependency(et->typeId());
+                for (auto &&parameterId : et->templateParameters())
+                    addDependency(parameterId);
             }
+        };
 
-            auto addFile = [&](const QString &data, const QString &ext, QStringList &section) {
-                QString fname(name + ext);
-                dir->addFile(fname)->setData(data);
-                section.append(fname);
-            };
+        for (auto &&id : ids)
+            addDependency(Common::ID(id));
 
-            if (!code.toHeader.isEmpty())
-                addFile(code.toHeader, ".h", m_ProfileData.headers);
-            if (!code.toSource.isEmpty())
-                addFile(code.toSource, ".cpp", m_ProfileData.sources);
+        return hash.result();
+    }
 
-        }
+    /**
+     * @brief BasicCppProjectGenerator::addFiles
+     * @param task
+     */
+    GenerationManifest::Entry BasicCppProjectGenerator::addFiles(const GenerationTask &task)
+    {
+        GenerationManifest::Entry entry{task.inputHash, {}, {}};
+        const QDir root(m_OutputDirectory);
 
-        for (auto &&s : scope->scopes())
-            generateFiles(s, dir);
+        QString name(task.type->name().toLower());
+        auto addFile = [&](const QString &data, const QString &ext, QStringList &section,
+                           QStringList &entryFiles) {
+            QString fname(name + ext);
+            auto file = task.directory->addFile(fname);
+            file->setData(data);
+            section.append(fname);
+            entryFiles.append(root.relativeFilePath(file->path()));
+        };
+
+        if (!task.code.toHeader.isEmpty())
+            addFile(task.code.toHeader, ".h", m_ProfileData.headers, entry.headers);
+        if (!task.code.toSource.isEmpty())
+            addFile(task.code.toSource, ".cpp", m_ProfileData.sources, entry.sources);
+
+        return entry;
     }
 
     /**
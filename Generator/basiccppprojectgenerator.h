@@ -23,7 +23,12 @@
 
 #pragma once
 
+#include <QVector>
+
+#include <Translation/code.h>
+
 #include "abstractprojectgenerator.h"
+#include "generationmanifest.h"
 #include "generator_types.hpp"
 
 namespace Generator {
@@ -51,13 +56,32 @@ namespace Generator {
                                  const QString &outputDirectory = "");
 
     private:
+        /// Type translation with its destination, code is filled in separately
+        struct GenerationTask
+        {
+            Entity::SharedType type;
+            Entity::SharedScope scope;
+            SharedVirtualDirectory directory;
+            Translation::Code code;
+            QByteArray inputHash;
+            bool upToDate = false;
+        };
+        using GenerationTasks = QVector<GenerationTask>;
+
         void doWrite() const override;
         void doGenerate() override;
-        void generateFiles(const Entity::SharedScope &scope, const SharedVirtualDirectory &directory);
+        void collectTasks(const Entity::SharedScope &scope, const SharedVirtualDirectory &directory,
+                          GenerationTasks &tasks) const;
+        Translation::Code generateCode(const GenerationTask &task) const;
+        QByteArray inputHash(const GenerationTask &task) const;
+        GenerationManifest::Entry addFiles(const GenerationTask &task);
         void addProfile();
 
         SharedVirtualDirectory m_RootOutputDirectory;
         Profile m_ProfileData;
+
+        GenerationManifest m_Manifest;
+        QStringList m_StaleFiles;
     };
 
 } // namespace generator
@@ -0,0 +1,186 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+
+#include "generationmanifest.h"
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+
+namespace Generator {
+
+    namespace {
+
+        const int manifestVersion = 1;
+
+        const QString versionMark = "Version";
+        const QString typesMark   = "Types";
+        const QString inputMark   = "Input";
+        const QString headersMark = "Headers";
+        const QString sourcesMark = "Sources";
+
+        QStringList toStringList(const QJsonValue &value)
+        {
+            QStringList result;
+            for (auto &&v : value.toArray())
+                result << v.toString();
+
+            return result;
+        }
+
+    } // namespace
+
+    /**
+     * @brief GenerationManifest::load
+     * @param directory
+     */
+    void GenerationManifest::load(const QString &directory)
+    {
+        m_Entries.clear();
+
+        // Missing or broken manifest just means that everything is generated again
+        QFile f(QDir(directory).filePath(fileName()));
+        if (!f.open(QIODevice::ReadOnly))
+            return;
+
+        const QJsonObject root = QJsonDocument::fromJson(f.readAll()).object();
+        if (root[versionMark].toInt() != manifestVersion)
+            return;
+
+        const QJsonObject types = root[typesMark].toObject();
+        for (auto it = types.begin(); it != types.end(); ++it) {
+            bool ok = false;
+            const Common::ID id(it.key().toULongLong(&ok));
+            if (!ok)
+                continue;
+
+            const QJsonObject obj = it.value().toObject();
+            m_Entries[id] = Entry{QByteArray::fromHex(obj[inputMark].toString().toLatin1()),
+                                  toStringList(obj[headersMark]),
+                                  toStringList(obj[sourcesMark])};
+        }
+    }
+
+    /**
+     * @brief GenerationManifest::save
+     * @param directory
+     * @return
+     */
+    bool GenerationManifest::save(const QString &directory) const
+    {
+        QJsonObject types;
+        for (auto it = m_Entries.begin(); it != m_Entries.end(); ++it) {
+            QJsonObject obj;
+            obj[inputMark]   = QString::fromLatin1(it->inputHash.toHex());
+            obj[headersMark] = QJsonArray::fromStringList(it->headers);
+            obj[sourcesMark] = QJsonArray::fromStringList(it->sources);
+            types[QString::number(it.key().value())] = obj;
+        }
+
+        QJsonObject root;
+        root[versionMark] = manifestVersion;
+        root[typesMark] = types;
+
+        QFile f(QDir(directory).filePath(fileName()));
+        if (!f.open(QIODevice::WriteOnly))
+            return false;
+
+        const QByteArray data = QJsonDocument(root).toJson(QJsonDocument::Compact);
+        return f.write(data) == data.size();
+    }
+
+    /**
+     * @brief GenerationManifest::isUpToDate
+     * @param typeID
+     * @param inputHash
+     * @param directory
+     * @return
+     */
+    bool GenerationManifest::isUpToDate(const Common::ID &typeID, const QByteArray &inputHash,
+                                        const QString &directory) const
+    {
+        auto it = m_Entries.find(typeID);
+        if (it == m_Entries.end() || it->inputHash != inputHash)
+            return false;
+
+        // Files can be removed by user
+        const QDir dir(directory);
+        for (auto &&file : it->headers + it->sources)
+            if (!QFile::exists(dir.filePath(file)))
+                return false;
+
+        return true;
+    }
+
+    /**
+     * @brief GenerationManifest::entry
+     * @param typeID
+     * @return
+     */
+    GenerationManifest::Entry GenerationManifest::entry(const Common::ID &typeID) const
+    {
+        return m_Entries.value(typeID);
+    }
+
+    /**
+     * @brief GenerationManifest::setEntry
+     * @param typeID
+     * @param entry
+     */
+    void GenerationManifest::setEntry(const Common::ID &typeID, const Entry &entry)
+    {
+        m_Entries[typeID] = entry;
+    }
+
+    /**
+     * @brief GenerationManifest::removeStale
+     * @param actualTypes
+     * @return
+     */
+    GenerationManifest::Entries GenerationManifest::removeStale(const QSet<Common::ID> &actualTypes)
+    {
+        Entries result;
+        for (auto it = m_Entries.begin(); it != m_Entries.end();) {
+            if (actualTypes.contains(it.key())) {
+                ++it;
+            } else {
+                result << *it;
+                it = m_Entries.erase(it);
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief GenerationManifest::fileName
+     * @return
+     */
+    QString GenerationManifest::fileName()
+    {
+        return ".generation_manifest";
+    }
+
+} // namespace generator
@@ -0,0 +1,71 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+
+#pragma once
+
+#include <QHash>
+#include <QSet>
+#include <QStringList>
+
+#include <Common/ID.h>
+
+#include "types.h"
+
+namespace Generator {
+
+    /**
+     * @brief The GenerationManifest class. Stores inputs and outputs of the previous
+     * generation next to the generated files, so unchanged types can be skipped
+     */
+    class GenerationManifest
+    {
+    public:
+        /**
+         * @brief The Entry struct. Paths are relative to the output directory
+         */
+        struct Entry
+        {
+            QByteArray inputHash;
+            QStringList headers;
+            QStringList sources;
+        };
+        using Entries = QList<Entry>;
+
+        void load(const QString &directory);
+        bool save(const QString &directory) const;
+
+        bool isUpToDate(const Common::ID &typeID, const QByteArray &inputHash,
+                        const QString &directory) const;
+
+        Entry entry(const Common::ID &typeID) const;
+        void setEntry(const Common::ID &typeID, const Entry &entry);
+
+        Entries removeStale(const QSet<Common::ID> &actualTypes);
+
+        static QString fileName();
+
+    private:
+        QHash<Common::ID, Entry> m_Entries;
+    };
+
+} // namespace generator
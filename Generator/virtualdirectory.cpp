@@ -160,17 +160,15 @@ namespace Generator {
     }
 
     /**
-     * @brief VirtualDirectory::write
+     * @brief VirtualDirectory::prepareWrite
+     * @param batch
      */
-    void VirtualDirectory::write() const
+    void VirtualDirectory::prepareWrite(WriteBatch &batch) const
     {
-        QDir().mkpath(m_FileInfo.filePath());
+        batch.directories << m_FileInfo.filePath();
 
-        if (m_FileInfo.isWritable())
-            for (auto &&file : m_Files.values())
-                file->write();
-        else if (m_ErrorList)
-            *m_ErrorList << QObject::tr("%1 is not writable.").arg(m_FileInfo.filePath());
+        for (auto &&file : m_Files)
+            file->prepareWrite(batch);
     }
 
     /**
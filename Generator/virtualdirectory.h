@@ -58,10 +58,11 @@ namespace Generator {
 
         void clearVirtualStructure();
 
-        void write() const override;
         bool remove() const override;
 
     protected:
+        void prepareWrite(WriteBatch &batch) const override;
+
         void moveFrom(VirtualDirectory &&src) noexcept;
         void copyFrom(const VirtualDirectory &src);
 
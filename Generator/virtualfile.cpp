@@ -25,7 +25,7 @@
 
 #include <QFileInfo>
 #include <QDir>
-#include <QTextStream>
+#include <QSaveFile>
 
 namespace Generator {
 
@@ -89,19 +89,66 @@ namespace Generator {
     }
 
     /**
-     * @brief VirtualFile::write
+     * @brief VirtualFile::content
+     * @return data as it's stored on the disk
      */
-    void VirtualFile::write() const
+    QByteArray VirtualFile::content() const
     {
-        if (!valid())
-            return;
-
-        QFile file(m_FileInfo.filePath());
-        if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-            QTextStream out(&file);
-            out << m_Data;
-        } else if (m_ErrorList)
-                *m_ErrorList << QObject::tr("Cannot create file %1.").arg(m_FileInfo.filePath());
+        QByteArray result = m_Data.toUtf8();
+#ifdef Q_OS_WIN
+        // The same as text mode does
+        result.replace("\n", "\r\n");
+#endif
+        return result;
+    }
+
+    /**
+     * @brief VirtualFile::isChanged
+     * @return true if the file on the disk has different content or doesn't exist
+     */
+    bool VirtualFile::isChanged() const
+    {
+        const QByteArray data = content();
+
+        QFileInfo info(m_FileInfo.filePath());
+        if (!info.exists() || info.size() != data.size())
+            return true;
+
+        QFile file(info.filePath());
+        if (!file.open(QIODevice::ReadOnly))
+            return true;
+
+        return file.readAll() != data;
+    }
+
+    /**
+     * @brief VirtualFile::commit
+     * @return
+     */
+    bool VirtualFile::commit() const
+    {
+        // Written to a temporary file and renamed, so old content is kept on failure
+        QSaveFile file(m_FileInfo.filePath());
+        if (!file.open(QIODevice::WriteOnly))
+            return false;
+
+        const QByteArray data = content();
+        if (file.write(data) != data.size()) {
+            file.cancelWriting();
+            return false;
+        }
+
+        return file.commit();
+    }
+
+    /**
+     * @brief VirtualFile::prepareWrite
+     * @param batch
+     */
+    void VirtualFile::prepareWrite(WriteBatch &batch) const
+    {
+        if (isChanged())
+            batch.files << this;
     }
 
     /**
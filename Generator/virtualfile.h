@@ -21,6 +21,8 @@
 **
 *****************************************************************************/
 
+#pragma once
+
 #include <QString>
 #include <QFileInfo>
 
@@ -42,9 +44,15 @@ namespace Generator {
         VirtualFile &appendData(const QString &data, const QString &sep = "\n");
         VirtualFile &prependData(const QString &data, const QString &sep = "\n");
 
-        void write() const override;
         bool remove() const override;
 
+        QByteArray content() const;
+        bool isChanged() const;
+        bool commit() const;
+
+    protected:
+        void prepareWrite(WriteBatch &batch) const override;
+
     private:
         QString m_Data;
     };
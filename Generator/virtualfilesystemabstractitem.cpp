@@ -25,6 +25,8 @@
 
 #include <QDir>
 
+#include "virtualfile.h"
+
 namespace Generator {
 
     /**
@@ -100,7 +102,9 @@ namespace Generator {
      */
     void VirtualFileSystemAbstractItem::write() const
     {
-        // stub
+        WriteBatch batch;
+        prepareWrite(batch);
+        writeBatch(batch);
     }
 
     /**
@@ -185,6 +189,35 @@ namespace Generator {
         m_ErrorList = errorList;
     }
 
+    /**
+     * @brief VirtualFileSystemAbstractItem::prepareWrite
+     * @param batch
+     */
+    void VirtualFileSystemAbstractItem::prepareWrite(WriteBatch &batch) const
+    {
+        // stub
+        Q_UNUSED(batch)
+    }
+
+    /**
+     * @brief VirtualFileSystemAbstractItem::writeBatch
+     * @param batch
+     */
+    void VirtualFileSystemAbstractItem::writeBatch(WriteBatch &batch) const
+    {
+        for (auto &&dir : batch.directories)
+            if (!QDir().mkpath(dir))
+                batch.failed << dir;
+
+        if (batch.failed.isEmpty())
+            for (auto &&file : batch.files)
+                if (!file->commit())
+                    batch.failed << file->path();
+
+        if (!batch.failed.isEmpty() && m_ErrorList)
+            *m_ErrorList << QObject::tr("Cannot write %1.").arg(batch.failed.join(", "));
+    }
+
     /**
      * @brief VirtualFileSystemAbstractItem::copyFrom
      * @param src
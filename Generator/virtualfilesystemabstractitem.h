@@ -26,9 +26,12 @@
 #include "types.h"
 
 #include <QFileInfo>
+#include <QVector>
 
 namespace Generator {
 
+    class VirtualFile;
+
     /**
      * @brief The VirtualFileSystemAbstractItem class
      */
@@ -58,6 +61,19 @@ namespace Generator {
         void setErrorList(const SharedErrorList &errorList);
 
     protected:
+        friend class VirtualDirectory;
+
+        /// Changed files of the whole tree. Nothing is written if any directory cannot be created
+        struct WriteBatch
+        {
+            QStringList directories;
+            QVector<const VirtualFile *> files;
+            QStringList failed;
+        };
+
+        virtual void prepareWrite(WriteBatch &batch) const;
+        void writeBatch(WriteBatch &batch) const;
+
         virtual void copyFrom(const VirtualFileSystemAbstractItem &src);
         virtual void moveFrom(VirtualFileSystemAbstractItem &&src) noexcept;
         void toNativeSeparators(); // just for better displaying
@@ -51,21 +51,36 @@ namespace Entity {
         }
     }
 
-    void uniquifyName(Common::BasicElement &ent, const QStringList &names)
-    {
-        Common::ID::ValueType counter = ent.id().value() - Common::ID::firstFreeID().value();
-        while (names.contains(ent.name())) {
+    namespace {
+
+        template <class Names>
+        void uniquifyNameImpl(Common::BasicElement &ent, const Names &names)
+        {
+            Common::ID::ValueType counter = ent.id().value() - Common::ID::firstFreeID().value();
+            while (names.contains(ent.name())) {
 
-            Q_ASSERT(counter != 0);
-            QString prevNum = QString::number(counter - 1);
-            QString newName = ent.name();
-            if (newName.endsWith(prevNum))
-                newName = newName.remove(prevNum).trimmed();
+                Q_ASSERT(counter != 0);
+                QString prevNum = QString::number(counter - 1);
+                QString newName = ent.name();
+                if (newName.endsWith(prevNum))
+                    newName = newName.remove(prevNum).trimmed();
 
-            ent.setName(newName + QChar::Space + QString::number(counter));
+                ent.setName(newName + QChar::Space + QString::number(counter));
 
-            ++counter;
+                ++counter;
+            }
         }
+
+    } // namespace
+
+    void uniquifyName(Common::BasicElement &ent, const QStringList &names)
+    {
+        uniquifyNameImpl(ent, names);
+    }
+
+    void uniquifyName(Common::BasicElement &ent, const TypesByName &names)
+    {
+        uniquifyNameImpl(ent, names);
     }
 
 } // namespace entity
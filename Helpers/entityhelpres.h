@@ -32,5 +32,7 @@ namespace Entity {
 
     /// Set unique name for entity
     void uniquifyName(Common::BasicElement &ent, const QStringList &names);
+    /// The same, but names are looked up in constant time
+    void uniquifyName(Common::BasicElement &ent, const TypesByName &names);
 
 } // namespace entity
@@ -24,9 +24,6 @@
 
 #include <functional>
 
-#include <range/v3/algorithm/find_if.hpp>
-#include <range/v3/numeric/accumulate.hpp>
-
 #include <QHash>
 #include <QIcon>
 
@@ -95,7 +92,19 @@ namespace Models {
      */
     void BasicTreeItem::appendChild(BasicTreeItem * child)
     {
+        Q_ASSERT(child);
+
+        child->m_Parent = this;
+        child->m_Row = m_Children.count();
         m_Children.append(child);
+
+        if (m_IndexValid) {
+            auto key = indexKey(child->id());
+            if (!m_ChildrenIndex.contains(key))
+                m_ChildrenIndex.insert(key, child);
+        }
+
+        updateSubtreeCount(1 + child->m_SubtreeCount);
     }
 
     /**
@@ -104,7 +113,7 @@ namespace Models {
     BasicTreeItem *BasicTreeItem::makeChild(const QVariant &entity, const TreeItemType &type)
     {
         BasicTreeItem *newChild = new BasicTreeItem(entity, type, this);
-        m_Children.append(newChild);
+        appendChild(newChild);
 
         return newChild;
     }
@@ -116,7 +125,8 @@ namespace Models {
      */
     BasicTreeItem::~BasicTreeItem()
     {
-        clear();
+        // Don't use clear() here: parent counters are already updated by removeChild()
+        qDeleteAll(m_Children);
     }
 
     /**
@@ -191,8 +201,20 @@ namespace Models {
      */
     BasicTreeItem *BasicTreeItem::itemById(const QVariant &id) const
     {
-        auto it = ranges::find_if(m_Children, [&](auto &&item){ return item->id() == id; });
-        return it != m_Children.end() ? *it : nullptr;
+        if (!m_IndexValid)
+            rebuildIndex();
+
+        auto item = m_ChildrenIndex.value(indexKey(id));
+        return item && item->id() == id ? item : nullptr;
+    }
+
+    /**
+     * @brief BasicTreeItem::invalidateIndex
+     */
+    void BasicTreeItem::invalidateIndex()
+    {
+        m_ChildrenIndex.clear();
+        m_IndexValid = false;
     }
 
     /**
@@ -202,12 +224,24 @@ namespace Models {
      */
     bool BasicTreeItem::removeChild(BasicTreeItem *child)
     {
-        if (m_Children.removeOne(child)) {
-            delete child;
-            return true;
+        const int row = rowForItem(child);
+        if (row == -1)
+            return false;
+
+        m_Children.removeAt(row);
+        for (int i = row, count = m_Children.count(); i < count; ++i)
+            m_Children[i]->m_Row = i;
+
+        if (m_IndexValid) {
+            auto key = indexKey(child->id());
+            if (m_ChildrenIndex.value(key) == child)
+                m_ChildrenIndex.remove(key);
         }
 
-        return false;
+        updateSubtreeCount(-(1 + child->m_SubtreeCount));
+        delete child;
+
+        return true;
     }
 
     /**
@@ -215,9 +249,13 @@ namespace Models {
      * @param item
      * @return
      */
-    int BasicTreeItem::rowForItem(BasicTreeItem *item) const
+    int BasicTreeItem::rowForItem(const BasicTreeItem *item) const
     {
-        return m_Children.indexOf(item);
+        if (item && item->m_Parent == this && item->m_Row < m_Children.count() &&
+            m_Children[item->m_Row] == item)
+            return item->m_Row;
+
+        return m_Children.indexOf(const_cast<BasicTreeItem *>(item));
     }
 
     /**
@@ -235,9 +273,7 @@ namespace Models {
      */
     int BasicTreeItem::childCount(bool recursive) const
     {
-        return recursive ? ranges::accumulate(m_Children, m_Children.count(),
-                                             [](int r, auto &&c) { return r + c->childCount(true); })
-                         : m_Children.count();
+        return recursive ? m_SubtreeCount : m_Children.count();
     }
 
     /**
@@ -346,7 +382,7 @@ namespace Models {
      */
     int BasicTreeItem::row() const
     {
-        return m_Parent ? m_Parent->m_Children.indexOf(const_cast<BasicTreeItem*>(this)) : 0;
+        return m_Parent ? m_Parent->rowForItem(this) : 0;
     }
 
     /**
@@ -381,7 +417,13 @@ namespace Models {
      */
     void BasicTreeItem::clear()
     {
+        updateSubtreeCount(-m_SubtreeCount);
+
         qDeleteAll(m_Children);
+        m_Children.clear();
+
+        m_ChildrenIndex.clear();
+        m_IndexValid = false;
     }
 
     /**
@@ -394,6 +436,13 @@ namespace Models {
         m_Entity   = std::move(src.m_Entity);
         m_Type     = std::move(src.m_Type);
         m_Parent   = std::move(src.m_Parent);
+        m_Row      = src.m_Row;
+
+        m_SubtreeCount = src.m_SubtreeCount;
+        src.m_Children.clear();
+        src.m_SubtreeCount = 0;
+
+        adoptChildren();
     }
 
     /**
@@ -406,6 +455,62 @@ namespace Models {
         m_Entity = src.m_Entity;
         m_Type   = src.m_Type;
         m_Parent = src.m_Parent;
+        m_Row    = src.m_Row;
+
+        m_SubtreeCount = src.m_SubtreeCount;
+
+        adoptChildren();
+    }
+
+    /**
+     * @brief BasicTreeItem::adoptChildren
+     */
+    void BasicTreeItem::adoptChildren()
+    {
+        for (int i = 0, count = m_Children.count(); i < count; ++i) {
+            m_Children[i]->m_Parent = this;
+            m_Children[i]->m_Row = i;
+        }
+
+        m_ChildrenIndex.clear();
+        m_IndexValid = false;
+    }
+
+    /**
+     * @brief BasicTreeItem::indexKey
+     * @param id
+     * @return
+     */
+    QString BasicTreeItem::indexKey(const QVariant &id)
+    {
+        // Projects are identified by names, other items by Common::ID
+        return id.userType() == qMetaTypeId<Common::ID>() ? id.value<Common::ID>().toString()
+                                                          : QLatin1Char('#') + id.toString();
+    }
+
+    /**
+     * @brief BasicTreeItem::rebuildIndex
+     */
+    void BasicTreeItem::rebuildIndex() const
+    {
+        m_ChildrenIndex.clear();
+        m_ChildrenIndex.reserve(m_Children.count());
+
+        // Reverse order, so the first child wins if IDs are duplicated
+        for (auto it = m_Children.crbegin(); it != m_Children.crend(); ++it)
+            m_ChildrenIndex.insert(indexKey((*it)->id()), *it);
+
+        m_IndexValid = true;
+    }
+
+    /**
+     * @brief BasicTreeItem::updateSubtreeCount
+     * @param delta
+     */
+    void BasicTreeItem::updateSubtreeCount(int delta)
+    {
+        for (auto item = this; item; item = item->m_Parent)
+            item->m_SubtreeCount += delta;
     }
 
 } // namespace models
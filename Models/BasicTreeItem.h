@@ -26,6 +26,7 @@
 
 #include <QString>
 #include <QVector>
+#include <QHash>
 #include <QMap>
 #include <QVariant>
 #include <QCoreApplication>
@@ -73,8 +74,9 @@ namespace Models {
         BasicTreeItem *makeChild(const QVariant &entity, const TreeItemType &type);
         BasicTreeItem *child(int row) const;
         BasicTreeItem *itemById(const QVariant &id) const;
+        void invalidateIndex(); // If ID of some child is changed, e.g. project is renamed
         bool removeChild(BasicTreeItem * child);
-        int rowForItem(BasicTreeItem * item) const;
+        int rowForItem(const BasicTreeItem *item) const;
         ChildItems childrenItems() const;
 
         int childCount(bool recursive = false) const;
@@ -102,6 +104,11 @@ namespace Models {
     private:
         void moveFrom(BasicTreeItem &&src) noexcept;
         void copyFrom(const BasicTreeItem &src);
+        void adoptChildren();
+
+        static QString indexKey(const QVariant &id);
+        void rebuildIndex() const;
+        void updateSubtreeCount(int delta);
 
         ChildItems m_Children;
 
@@ -109,6 +116,13 @@ namespace Models {
         TreeItemType m_Type;
 
         BasicTreeItem *m_Parent;
+
+        // Children by ID, built on the first lookup and kept up to date on insert and remove
+        mutable QHash<QString, BasicTreeItem *> m_ChildrenIndex;
+        mutable bool m_IndexValid = false;
+
+        int m_Row = 0;          // Position in the parent node
+        int m_SubtreeCount = 0; // Count of all descendants
     };
 
 } // namespace models
@@ -22,8 +22,11 @@
 *****************************************************************************/
 #include "ComponentsModel.h"
 
+#include <algorithm>
 #include <type_traits>
 
+#include <DB/ProjectDatabase.h>
+
 #include <Entity/Class.h>
 #include <Entity/ClassMethod.h>
 #include <Entity/Enum.h>
@@ -32,33 +35,12 @@
 
 #include <Translation/signaturemaker.h>
 
+#include <QtHelpers.h>
+
 namespace Models {
 
     namespace  {
         const int colCount = 2;
-
-        int count(const Entity::SharedComponents &components, DisplayPart part)
-        {
-            switch (part) {
-                case DisplayPart::Fields:
-                    return components->fields().count();
-
-                case DisplayPart::Methods:
-                    return components->methods().count();
-
-                case DisplayPart::Elements:
-                    return components->enumerators().count();
-
-                case DisplayPart::Properties:
-                    return 0;
-
-                case DisplayPart::Invalid:
-                    return 0;
-
-                default:
-                    return 0;
-            }
-        }
     }
 
     /**
@@ -78,6 +60,35 @@ namespace Models {
     void ComponentsModel::setSignatureMaker(Translation::UniqueSignatureMaker &&maker)
     {
         m_SignatureMaker = std::move(maker);
+        watchTypes();
+        invalidateSignatures();
+    }
+
+    /**
+     * @brief ComponentsModel::watchTypes
+     */
+    void ComponentsModel::watchTypes()
+    {
+        for (auto &&c : m_TypesConnections)
+            disconnect(c);
+        m_TypesConnections.clear();
+
+        if (!m_SignatureMaker)
+            return;
+
+        // Names of used types are a part of signatures
+        auto watchDatabase = [this](const DB::SharedDatabase &db) {
+            if (!db)
+                return;
+
+            auto invalidate = [this] { invalidateSignatures(); };
+            m_TypesConnections << G_CONNECT(db.get(), &DB::Database::typeRenamed, this, invalidate)
+                               << G_CONNECT(db.get(), &DB::Database::typeIdChanged, this, invalidate)
+                               << G_CONNECT(db.get(), &DB::Database::typeRemoved, this, invalidate);
+        };
+
+        watchDatabase(m_SignatureMaker->globalDatabase());
+        watchDatabase(m_SignatureMaker->projectDatabase());
     }
 
     /**
@@ -87,9 +98,35 @@ namespace Models {
     {
         beginResetModel();
         m_Components.reset();
+        resetRows();
         endResetModel();
     }
 
+    /**
+     * @brief ComponentsModel::invalidateSignatures
+     */
+    void ComponentsModel::invalidateSignatures()
+    {
+        for (auto &&row : m_Rows)
+            row.signatureValid = false;
+
+        if (!m_Rows.isEmpty())
+            emit dataChanged(index(0, ShortSignature), index(m_Rows.count() - 1, ShortSignature));
+    }
+
+    /**
+     * @brief ComponentsModel::invalidateSignature
+     * @param row
+     */
+    void ComponentsModel::invalidateSignature(int row)
+    {
+        if (row < 0 || row >= m_Rows.count())
+            return;
+
+        m_Rows[row].signatureValid = false;
+        emit dataChanged(index(row, ShortSignature), index(row, ShortSignature));
+    }
+
     /**
      * @brief ComponentsModel::addMethod
      */
@@ -230,7 +267,7 @@ namespace Models {
     int ComponentsModel::rowCount(const QModelIndex &parent) const
     {
         Q_UNUSED(parent);
-        return m_Components ? count(m_Components, m_display) : 0;
+        return m_Components ? m_Rows.count() : 0;
     }
 
     /**
@@ -255,45 +292,19 @@ namespace Models {
         Q_ASSERT(m_SignatureMaker);
         // TODO: use maps of lambdas instead
 
-        if (role == Qt::DisplayRole && m_Components) {
-            if (index.column() == 0) {
-                switch (m_display) {
-                    case DisplayPart::Methods:
-                        return m_SignatureMaker->signature(m_Components->methods()[index.row()]);
-
-                    case DisplayPart::Fields:
-                        return m_SignatureMaker->signature(m_Components->fields()[index.row()]);
+        const bool validRow = m_Components && index.row() >= 0 && index.row() < m_Rows.count();
 
-                    case DisplayPart::Elements:
-                        return m_Components->enumerators()[index.row()]->name(); // TODO: add variables to signature maker
-
-                    case DisplayPart::Properties:
-                        return m_Components->properties()[index.row()]->name(); // TODO: add variables to signature maker
+        if (role == Qt::DisplayRole && validRow) {
+            if (index.column() == 0) {
+                if (m_display == DisplayPart::Invalid)
+                    return tr("Invalid display value");
 
-                    case DisplayPart::Invalid:
-                        return tr("Invalid display value");
-                }
+                return signature(index.row());
             }
         }
 
-        if (role == InternalData && m_Components) {
-            switch (m_display) {
-                case DisplayPart::Methods:
-                    return QVariant::fromValue(m_Components->methods()[index.row()]);
-
-                case DisplayPart::Fields:
-                    return QVariant::fromValue(m_Components->fields()[index.row()]);
-
-                case DisplayPart::Elements:
-                    return QVariant::fromValue(m_Components->enumerators()[index.row()]);
-
-                case DisplayPart::Properties:
-                    return QVariant::fromValue(m_Components->properties()[index.row()]);
-
-                case DisplayPart::Invalid:
-                    return QVariant();
-            }
-        }
+        if (role == InternalData && validRow)
+            return m_Rows[index.row()].component;
 
         if (role == Qt::ToolTipRole && index.column() == 0)
             return tr("Component short signature. Double click to fast edit.");
@@ -345,10 +356,22 @@ namespace Models {
                         break;
                     }
 
+                    case DisplayPart::Methods:
+                    {
+                        auto dstMethod = ent.value<Entity::SharedMethod>();
+                        Q_ASSERT(dstMethod);
+
+                        auto srcMethod = value.value<Common::SharedBasicEntity>();
+                        Q_ASSERT(srcMethod);
+
+                        *dstMethod = *std::static_pointer_cast<Entity::ClassMethod>(srcMethod);
+                        break;
+                    }
+
                     default: ;
                 }
 
-                dataChanged(index, index);
+                invalidateSignature(index.row());
                 return true;
             }
 
@@ -357,6 +380,17 @@ namespace Models {
         }
     }
 
+    /**
+     * @brief ComponentsModel::element
+     * @param index
+     * @return component of the given row
+     */
+    Common::SharedBasicEntity ComponentsModel::element(const QModelIndex &index) const
+    {
+        return index.row() >= 0 && index.row() < m_Rows.count() ? m_Rows[index.row()].element
+                                                                : nullptr;
+    }
+
     /**
      * @brief ClassComponentsModel::components
      * @return
@@ -374,6 +408,7 @@ namespace Models {
     {
         beginResetModel();
         m_Components = components;
+        resetRows();
         endResetModel();
 
         updateAllComponents();
@@ -397,6 +432,7 @@ namespace Models {
         if (display != m_display) {
             beginResetModel();
             m_display = display;
+            resetRows();
             endResetModel();
 
             updateAllComponents();
@@ -414,6 +450,7 @@ namespace Models {
         int innerIndex = pos == -1 ? count : pos;
         beginInsertRows(QModelIndex(), innerIndex, innerIndex);
         inserter(innerIndex);
+        m_Rows.insert(innerIndex, makeRow(innerIndex));
         endInsertRows();
 
         showButtons(QModelIndexList() << index(innerIndex, 1));
@@ -432,6 +469,8 @@ namespace Models {
 
         beginRemoveRows(QModelIndex(), index.row(), index.row());
         int pos = deleter(index.row());
+        disconnectRow(m_Rows[index.row()]);
+        m_Rows.removeAt(index.row());
         endRemoveRows();
 
         return pos;
@@ -442,7 +481,7 @@ namespace Models {
      */
     void ComponentsModel::updateAllComponents()
     {
-        int componentsCount = count(m_Components, m_display);
+        int componentsCount = m_Rows.count();
         QModelIndexList out;
         out.reserve(componentsCount);
         for (int i = 0; i < componentsCount; ++i) {
@@ -452,4 +491,118 @@ namespace Models {
        emit showButtons(out);
     }
 
+    /**
+     * @brief ComponentsModel::makeRow
+     * @param pos
+     * @return row for the component at the given position of the current part
+     */
+    ComponentsModel::Row ComponentsModel::makeRow(int pos)
+    {
+        switch (m_display) {
+            case DisplayPart::Methods:
+                return makeRow(m_Components->methods()[pos]);
+
+            case DisplayPart::Fields:
+                return makeRow(m_Components->fields()[pos]);
+
+            case DisplayPart::Elements:
+                return makeRow(m_Components->enumerators()[pos]);
+
+            case DisplayPart::Properties:
+                return makeRow(m_Components->properties()[pos]);
+
+            default:
+                return Row();
+        }
+    }
+
+    /**
+     * @brief ComponentsModel::connectRow
+     * @param row
+     */
+    void ComponentsModel::connectRow(const ComponentsModel::Row &row)
+    {
+        if (auto element = row.element.get()) {
+            G_CONNECT(element, &Common::BasicElement::changed, this, [this, element] {
+                auto it = std::find_if(m_Rows.begin(), m_Rows.end(),
+                                       [&](auto &&r) { return r.element.get() == element; });
+                if (it != m_Rows.end())
+                    invalidateSignature(int(std::distance(m_Rows.begin(), it)));
+            });
+        }
+    }
+
+    /**
+     * @brief ComponentsModel::disconnectRow
+     * @param row
+     */
+    void ComponentsModel::disconnectRow(const ComponentsModel::Row &row)
+    {
+        if (row.element)
+            row.element->disconnect(this);
+    }
+
+    /**
+     * @brief ComponentsModel::resetRows
+     */
+    void ComponentsModel::resetRows()
+    {
+        for (auto &&row : m_Rows)
+            disconnectRow(row);
+        m_Rows.clear();
+
+        if (!m_Components)
+            return;
+
+        auto append = [this](const auto &components) {
+            m_Rows.reserve(components.count());
+            for (auto &&component : components)
+                m_Rows << makeRow(component);
+        };
+
+        switch (m_display) {
+            case DisplayPart::Methods:
+                append(m_Components->methods());
+                break;
+
+            case DisplayPart::Fields:
+                append(m_Components->fields());
+                break;
+
+            case DisplayPart::Elements:
+                append(m_Components->enumerators());
+                break;
+
+            default: ; // Properties are not displayed yet
+        }
+    }
+
+    /**
+     * @brief ComponentsModel::signature
+     * @param row
+     * @return cached signature, it's built only when the row is requested first time
+     */
+    QString ComponentsModel::signature(int row) const
+    {
+        auto &&cached = m_Rows[row];
+        if (cached.signatureValid)
+            return cached.signature;
+
+        switch (m_display) {
+            case DisplayPart::Methods:
+                cached.signature = m_SignatureMaker->signature(cached.component.value<Entity::SharedMethod>());
+                break;
+
+            case DisplayPart::Fields:
+                cached.signature = m_SignatureMaker->signature(cached.component.value<Entity::SharedField>());
+                break;
+
+            default:
+                cached.signature = cached.element->name(); // TODO: add variables to signature maker
+        }
+
+        cached.signatureValid = true;
+        return cached.signature;
+    }
+
 } // namespace models
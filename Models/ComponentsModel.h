@@ -25,7 +25,9 @@
 #include <functional>
 
 #include <QAbstractTableModel>
+#include <QVector>
 
+#include <Common/CommonTypes.hpp>
 #include <Entity/EntityTypes.hpp>
 #include <GUI/GuiTypes.hpp>
 #include <Translation/translator_types.hpp>
@@ -68,6 +70,9 @@ namespace Models {
         void setSignatureMaker(Translation::UniqueSignatureMaker &&maker);
         void clear();
 
+        void invalidateSignatures();
+        void invalidateSignature(int row);
+
         // TODO: try to use templates {
         Entity::SharedMethod addMethod();
         void addExistsMethod(const Entity::SharedMethod &method, int pos = -1);
@@ -96,6 +101,8 @@ namespace Models {
         Qt::ItemFlags flags(const QModelIndex &index) const override;
         bool setData(const QModelIndex &index, const QVariant &value, int role) override;
 
+        Common::SharedBasicEntity element(const QModelIndex &index) const;
+
         Entity::SharedComponents components() const;
         void setComponents(const Entity::SharedComponents &components);
 
@@ -105,12 +112,23 @@ namespace Models {
     signals:
         void showButtons(const QModelIndexList &index);
 
+    private: // Types
+        /// Cached data of a single row
+        struct Row
+        {
+            QVariant component;                ///< Typed component handle
+            Common::SharedBasicEntity element; ///< The same component, used for connections
+            QString signature;
+            bool signatureValid = false;
+        };
+
     private:
         template<class Component>
         decltype(auto) add(const std::function<Component()> &componentMaker, int count)
         {
             beginInsertRows(QModelIndex(), count, count);
             auto component = componentMaker();
+            m_Rows.insert(count, makeRow(component));
             endInsertRows();
 
             showButtons(QModelIndexList() << index(count, 1));
@@ -122,10 +140,29 @@ namespace Models {
         int remove(const std::function<int(int)> &deleter, const QModelIndex &index);
         void updateAllComponents();
 
+        template<class Component>
+        Row makeRow(const std::shared_ptr<Component> &component)
+        {
+            Row row;
+            row.component = QVariant::fromValue(component);
+            row.element = component;
+            connectRow(row);
+            return row;
+        }
+
+        Row makeRow(int pos);
+        void connectRow(const Row &row);
+        void watchTypes();
+        void disconnectRow(const Row &row);
+        void resetRows();
+        QString signature(int row) const;
+
     private:
         Entity::SharedComponents m_Components;
         Translation::UniqueSignatureMaker m_SignatureMaker;
+        QVector<QMetaObject::Connection> m_TypesConnections;
         DisplayPart m_display = DisplayPart::Invalid;
+        mutable QVector<Row> m_Rows;
     };
 
 } // namespace models
@@ -26,8 +26,6 @@
 #include <QFont>
 #include <QDebug>
 
-#include <range/v3/algorithm/find_if.hpp>
-
 #include <Project/Project.h>
 
 #include <Entity/Scope.h>
@@ -222,7 +220,7 @@ namespace Models {
         BasicTreeItem *parentItem =
             parent.isValid() ? static_cast<BasicTreeItem*>(parent.internalPointer()) : nullptr;
         BasicTreeItem *childItem  =
-            parentItem ? parentItem->child(row) : &m_Projects[row];
+            parentItem ? parentItem->child(row) : m_Root.child(row);
 
         return childItem ? createIndex(row, column, childItem) : QModelIndex();
     }
@@ -240,7 +238,8 @@ namespace Models {
         BasicTreeItem *childItem = static_cast<BasicTreeItem*>(child.internalPointer());
         BasicTreeItem *parentItem = childItem->parentNode();
 
-        return parentItem ? createIndex(parentItem->row(), 0, parentItem) : QModelIndex();
+        return parentItem && parentItem != &m_Root ? createIndex(parentItem->row(), 0, parentItem)
+                                                   : QModelIndex();
     }
 
     /**
@@ -253,7 +252,7 @@ namespace Models {
         if (parent.column() > 0)
             return 0;
 
-        return !parent.isValid() ? m_Projects.count()
+        return !parent.isValid() ? m_Root.childCount()
                                  : static_cast<BasicTreeItem*>(parent.internalPointer())->childCount();
     }
 
@@ -277,27 +276,20 @@ namespace Models {
      */
     bool ProjectTreeModel::removeRows(int row, int count, const QModelIndex &parent)
     {
-        beginRemoveRows(parent, row, row + count);
-
-        bool result = false;
-        if (parent.isValid()) {
-            BasicTreeItem *item = static_cast<BasicTreeItem*>(parent.internalPointer());
-            for (int i = row; i <= row + count; ++i)
-                result = item->removeChild(item->child(i));
-        } else {
-            if (m_Projects.size() < row) {
-                auto it = std::find(m_Projects.begin(), m_Projects.end(), m_Projects.at(row));
-
-                if (it != m_Projects.end()) {
-                    m_Projects.erase(it, it + count);
-                    result = true;
-                }
-            } else {
-                result = false;
-            }
-        }
+        BasicTreeItem *item = parent.isValid() ? itemForIndex(parent) : &m_Root;
+        if (!item || row < 0 || count <= 0 || row + count > item->childCount())
+            return false;
+
+        const bool notify = !isBulkLoading();
+        if (notify)
+            beginRemoveRows(parent, row, row + count - 1);
 
-        endRemoveRows();
+        bool result = true;
+        for (int i = 0; i < count; ++i)
+            result = item->removeChild(item->child(row)) && result;
+
+        if (notify)
+            endRemoveRows();
 
         return result;
     }
@@ -312,10 +304,16 @@ namespace Models {
             return;
 
         addProjectItem(pr);
-        G_CONNECT(pr.get(), &Projects::Project::scopeAdded,
+        G_CONNECT(pr.get(), &Projects::Project::scopeAdded, this,
                   [this](auto &&prName, auto &&scope){ this->addScope(scope, prName); });
-        G_CONNECT(pr.get(), &Projects::Project::scopeRemoved,
+        G_CONNECT(pr.get(), &Projects::Project::scopeRemoved, this,
                   [this](auto &&prName, auto &&scope){ this->removeScope(scope->id(), prName); });
+
+        // Loading of the database is reported by a single reset
+        G_CONNECT(pr.get(), &Projects::Project::bulkLoadStarted,
+                  this, &ProjectTreeModel::beginBulkLoad);
+        G_CONNECT(pr.get(), &Projects::Project::bulkLoadFinished,
+                  this, &ProjectTreeModel::endBulkLoad);
     }
 
     /**
@@ -325,16 +323,10 @@ namespace Models {
     void ProjectTreeModel::removeProject(const Projects::SharedProject &pr)
     {
         if (pr) {
-            auto it = ranges::find_if(
-                m_Projects, [&](auto &&p) { return p.id().toString() == pr->name(); });
-            if (it != m_Projects.end()) {
-                auto index = m_Projects.indexOf(*it);
-                beginRemoveRows(QModelIndex(), index, index);
-
-                m_Projects.erase(it);
+            if (auto item = find(pr->name()))
+                removeRow(indexOf(item));
 
-                endRemoveRows();
-            }
+            disconnect(pr.get(), nullptr, this, nullptr);
         }
     }
 
@@ -349,10 +341,9 @@ namespace Models {
             auto &&projectIndex = index(indexOf(pr), 0);
             Q_ASSERT(projectIndex.isValid());
 
-            auto pos = projectIndex.row() + 1;
-            beginInsertRows(projectIndex, pos, pos);
+            beginInsert(projectIndex, pr->childCount());
             pr->makeChild(QVariant::fromValue(scope), TreeItemType::ScopeItem);
-            endInsertRows();
+            endInsert();
         }
     }
 
@@ -371,7 +362,7 @@ namespace Models {
                 auto &&scopeIndex = projectIndex.child(pr->rowForItem(scope), 0);
                 Q_ASSERT(scopeIndex.isValid());
 
-                removeRows(scopeIndex.row(), 0, projectIndex);
+                removeRow(scopeIndex.row(), projectIndex);
             }
         }
     }
@@ -393,10 +384,9 @@ namespace Models {
                 auto &&scopeIndex = projectIndex.child(pr->rowForItem(scope), 0);
                 Q_ASSERT(scopeIndex.isValid());
 
-                auto pos = scopeIndex.row() + 1;
-                beginInsertRows(scopeIndex, pos, pos);
+                beginInsert(scopeIndex, scope->childCount());
                 scope->makeChild(QVariant::fromValue(type), TreeItemType::TypeItem);
-                endInsertRows();
+                endInsert();
             }
         }
     }
@@ -446,12 +436,11 @@ namespace Models {
      */
     void ProjectTreeModel::addProjectItem(const Projects::SharedProject &pr)
     {
-        beginInsertRows(QModelIndex(), rowCount(), rowCount() + 1);
-        m_Projects << BasicTreeItem(QVariant::fromValue(pr), TreeItemType::ProjectItem);
-        endInsertRows();
+        // Whole project subtree is inserted as a single row
+        beginInsert(QModelIndex(), m_Root.childCount());
+        auto projectItem = m_Root.makeChild(QVariant::fromValue(pr), TreeItemType::ProjectItem);
 
         DB::SharedProjectDatabase database = pr->database();
-        auto projectItem = &m_Projects.last();
         for (auto &&scope : database->scopes()) {
             auto scopeItem = addItem(QVariant::fromValue(scope), projectItem, TreeItemType::ScopeItem);
 
@@ -466,7 +455,13 @@ namespace Models {
             }
         }
 
-        connect(pr.get(), &Projects::Project::nameChanged, [=]{ update(projectItem); });
+        endInsert();
+
+        // Projects are identified by names
+        connect(pr.get(), &Projects::Project::nameChanged, this, [=]{
+            m_Root.invalidateIndex();
+            update(projectItem);
+        });
     }
 
     /**
@@ -476,7 +471,7 @@ namespace Models {
      */
     int ProjectTreeModel::indexOf(const BasicTreeItem *parent)
     {
-        return m_Projects.indexOf(*parent);
+        return m_Root.rowForItem(parent);
     }
 
     /**
@@ -496,8 +491,7 @@ namespace Models {
      */
     const BasicTreeItem *ProjectTreeModel::find(const QVariant &id) const
     {
-        auto projectIt = ranges::find_if(m_Projects, [&](auto &&item){ return item.id() == id; });
-        return projectIt != m_Projects.cend() ? &*projectIt : nullptr;
+        return m_Root.itemById(id);
     }
 
     /**
@@ -510,7 +504,7 @@ namespace Models {
         auto parent = item; // can be Project
         QList<BasicTreeItem *> items;
         items.push_front(parent);
-        while (parent->parentNode()) {
+        while (parent->parentNode() && parent->parentNode() != &m_Root) {
             parent = parent->parentNode();
             items.push_front(parent);
         }
@@ -536,4 +530,52 @@ namespace Models {
         emit dataChanged(topLeftIndex, bottomRightIndex);
     }
 
+    /**
+     * @brief ProjectTreeModel::beginBulkLoad
+     */
+    void ProjectTreeModel::beginBulkLoad()
+    {
+        if (m_BulkLoadDepth++ == 0)
+            beginResetModel();
+    }
+
+    /**
+     * @brief ProjectTreeModel::endBulkLoad
+     */
+    void ProjectTreeModel::endBulkLoad()
+    {
+        Q_ASSERT(m_BulkLoadDepth > 0);
+        if (--m_BulkLoadDepth == 0)
+            endResetModel();
+    }
+
+    /**
+     * @brief ProjectTreeModel::isBulkLoading
+     * @return
+     */
+    bool ProjectTreeModel::isBulkLoading() const
+    {
+        return m_BulkLoadDepth > 0;
+    }
+
+    /**
+     * @brief ProjectTreeModel::beginInsert
+     * @param parent
+     * @param row
+     */
+    void ProjectTreeModel::beginInsert(const QModelIndex &parent, int row)
+    {
+        if (!isBulkLoading())
+            beginInsertRows(parent, row, row);
+    }
+
+    /**
+     * @brief ProjectTreeModel::endInsert
+     */
+    void ProjectTreeModel::endInsert()
+    {
+        if (!isBulkLoading())
+            endInsertRows();
+    }
+
 } // namespace models
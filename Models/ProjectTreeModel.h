@@ -63,6 +63,10 @@ namespace Models {
         void removeType(const QString &projectName, const Common::ID &scopeID,
                         const Common::ID &typeID);
 
+        void beginBulkLoad();
+        void endBulkLoad();
+        bool isBulkLoading() const;
+
     public slots:
         void onCurrentProjectChanged(const Projects::SharedProject &previous,
                                      const Projects::SharedProject &current);
@@ -75,9 +79,13 @@ namespace Models {
         BasicTreeItem *find(const QVariant &id);
         const BasicTreeItem *find(const QVariant &id) const;
         void update(BasicTreeItem *item);
+        void beginInsert(const QModelIndex &parent, int row);
+        void endInsert();
 
-        mutable QList<BasicTreeItem> m_Projects; // TODO: store as pointers
+        BasicTreeItem m_Root; // Invisible root, projects are its children
         Projects::SharedProject m_CurrentProject;
+
+        int m_BulkLoadDepth = 0; // Model is reset once at the end instead of per row signals
     };
 
 } // namespace models
@@ -27,9 +27,12 @@
 #include "Project.h"
 
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
+#include <QFutureWatcher>
 #include <QJsonObject>
 #include <QDebug>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <Common/BasicElement.h>
 
@@ -37,6 +40,7 @@
 #include <Entity/Scope.h>
 #include <Entity/EntityFactory.h>
 
+#include <DB/BinaryFormat.h>
 #include <DB/ProjectDatabase.h>
 
 #include <GUI/graphics/Entity.h>
@@ -53,6 +57,9 @@ namespace Projects {
 
     namespace {
 
+        // Journal is rewritten into the main files when it reaches this size
+        const qint64 journalCompactionSize = 4 << 20;
+
         Entity::SharedScope makeProjectScope()
         {
             auto scope(std::make_shared<Entity::Scope>());
@@ -60,6 +67,37 @@ namespace Projects {
             return scope;
         }
 
+        /// Project state taken on the GUI thread. JSON values are implicitly shared and
+        /// immutable, so the snapshot can be safely passed to another thread
+        struct Snapshot
+        {
+            QString path;
+            QString projectFile;
+            QJsonObject project;
+            QString databaseFile;
+            QJsonObject database;
+            bool binaryDatabase;
+        };
+
+        ErrorList writeSnapshot(const Snapshot &snapshot)
+        {
+            ErrorList errors;
+
+            if (!QDir(snapshot.path).exists() && !QDir().mkpath(snapshot.path)) {
+                errors << Project::tr("Cannot create project directory.");
+                return errors;
+            }
+
+            if (!DB::Binary::writeFile(snapshot.project, snapshot.projectFile, false /*binary*/))
+                errors << Project::tr("Cannot save project to file.");
+
+            if (!DB::Binary::writeFile(snapshot.database, snapshot.databaseFile,
+                                       snapshot.binaryDatabase))
+                errors << Project::tr("Cannot save database to file.");
+
+            return errors;
+        }
+
     } // namespace
 
     /**
@@ -86,6 +124,20 @@ namespace Projects {
                   [this](auto &&scope){ emit scopeAdded(this->name(), scope); });
         G_CONNECT(m_Database.get(), &DB::ProjectDatabase::scopeRemoved,
                   [this](auto &&scope){ emit scopeRemoved(this->name(), scope); });
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::bulkLoadStarted,
+                  [this]{ emit bulkLoadStarted(this->name()); });
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::bulkLoadFinished,
+                  [this]{ emit bulkLoadFinished(this->name()); });
+
+        // Changes made without commands
+        auto invalidate = [this]{ invalidateSnapshot(); };
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::scopeAdded, invalidate);
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::scopeRemoved, invalidate);
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::typeRemoved, invalidate);
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::typeRenamed, invalidate);
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::typeIdChanged, invalidate);
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::relationAdded, invalidate);
+        G_CONNECT(m_Database.get(), &DB::ProjectDatabase::relationRemoved, invalidate);
     }
 
     /**
@@ -93,19 +145,18 @@ namespace Projects {
      * @param src
      */
     Project::Project(Project &&src) noexcept
-        : m_Name(std::move(src.m_Name))
-        , m_Path(std::move(src.m_Path))
-        , m_nextUniqueID(std::move(src.m_nextUniqueID))
-        , m_Modified(src.m_Modified)
-        , m_Database(std::move(src.m_Database))
-        , m_CommandsStack(std::move(src.m_CommandsStack))
+        : m_Modified(false)
     {
+        *this = std::move(src);
     }
 
     /**
      * @brief Project::~Project
      */
-    Project::~Project() = default;
+    Project::~Project()
+    {
+        waitForPendingWrites();
+    }
 
     /**
      * @brief Project::operator =
@@ -115,12 +166,20 @@ namespace Projects {
     Project &Project::operator =(Project &&lhs) noexcept
     {
         if (this != &lhs) {
+            // The pending write is bound to the object which started it
+            waitForPendingWrites();
+            lhs.waitForPendingWrites();
+
+            invalidateSnapshot();
+            lhs.invalidateSnapshot();
+
             m_Name = std::move(lhs.m_Name);
             m_Path = std::move(lhs.m_Path);
             m_nextUniqueID = std::move(lhs.m_nextUniqueID);
             m_Modified = lhs.m_Modified;
             m_Database = std::move(lhs.m_Database);
             m_CommandsStack = std::move(lhs.m_CommandsStack);
+            m_Journal = std::move(lhs.m_Journal);
         }
 
         return *this;
@@ -151,6 +210,7 @@ namespace Projects {
         Q_ASSERT(!!m_Database);
 
         m_Errors.clear();
+        invalidateSnapshot();
 
         if (!Util::readFromFile(*this, path))
             m_Errors << tr("Cannot read project file.");
@@ -164,9 +224,40 @@ namespace Projects {
 
         m_Database->setPath(m_Path);
         m_Database->setName(databaseFileName());
-        m_Database->load(m_Errors);
+        {
+            qthelpers::BulkLoadGuard<DB::ProjectDatabase> bulkLoad(m_Database.get());
+            m_Database->load(m_Errors);
+        }
+
+        // Restore changes which were not saved before a crash
+        bool recovered = false;
+        waitForAutosaved();
+        m_Journal.setFileName(journalPath());
+        m_Journal.resetBaseline();
+        if (m_Journal.exists()) {
+            const QJsonObject savedProject = toJson();
+            const QJsonObject savedDatabase = m_Database->toJson();
+
+            QJsonObject project = savedProject;
+            QJsonObject database = savedDatabase;
+            if (ProjectJournal::replay(m_Journal.fileName(), project, database, m_Errors) > 0) {
+                fromJson(project, m_Errors);
+                {
+                    qthelpers::BulkLoadGuard<DB::ProjectDatabase> bulkLoad(m_Database.get());
+                    m_Database->fromJson(database, m_Errors);
+                }
+
+                // Rewrite the journal without a torn tail, otherwise new records are lost
+                m_Journal.setBaseline(savedProject, savedDatabase);
+                m_Journal.record(project, database);
+                m_Journal.flush(true /*truncate*/);
+                recovered = true;
+            } else {
+                m_Journal.discard();
+            }
+        }
 
-        setModified(!m_Errors.isEmpty());
+        setModified(recovered || !m_Errors.isEmpty());
 
         // Fixup if needed
         if (!m_Database->scope(Common::ID::projectScopeID()))
@@ -178,37 +269,280 @@ namespace Projects {
 
     /**
      * @brief Project::save
+     * Writing is performed asynchronously. Requests made while the project is being written
+     * are coalesced into one more save of the latest state.
+     * Entities are not thread safe, so the snapshot is serialized on the GUI thread, see
+     * lastSnapshotTime(). It's shared with autosave and reused until the project is changed.
      */
     void Project::save()
+    {
+        if (isSaving())
+            m_SaveRequested = true;
+        else
+            startSave();
+    }
+
+    /**
+     * @brief Project::isSaving
+     * @return
+     */
+    bool Project::isSaving() const
+    {
+        return !m_SaveHandled;
+    }
+
+    /**
+     * @brief Project::waitForSaved
+     * @return true if the last save is successful
+     */
+    bool Project::waitForSaved()
+    {
+        while (isSaving()) {
+            m_SaveFuture.waitForFinished();
+            onSaveFinished();
+        }
+
+        return m_Errors.isEmpty();
+    }
+
+    /**
+     * @brief Project::lastSnapshotTime
+     * @return time of the last snapshot serialization on the GUI thread, ms
+     */
+    qint64 Project::lastSnapshotTime() const
+    {
+        return m_SnapshotTime;
+    }
+
+    /**
+     * @brief Project::startSave
+     */
+    void Project::startSave()
     {
         Q_ASSERT(!!m_Database);
 
         m_Errors.clear();
 
-        if (!m_Path.isEmpty()) {
-            QDir dir(m_Path);
-            if (!dir.exists())
-                if (!dir.mkpath(m_Path)) {
-                    m_Errors << tr("Cannot create project directory.");
-                    emit errors(tr("Make path error%1").arg(m_Errors.count() <= 1 ? "" : "s"), m_Errors);
-                    return;
-                }
+        if (m_Path.isEmpty()) {
+            m_Errors << tr("Project path is empty.");
+            setModified(true);
+            emit errors(tr("Project save error"), m_Errors);
+            emit saved(false);
+            return;
+        }
+
+        m_Database->setName(databaseFileName());
+        m_Database->setPath(m_Path);
 
-            if (!Util::writeToFile(*this, projectPath(m_Path)))
-                m_Errors << tr("Cannot save project to file.");
+        updateSnapshot();
+        Snapshot snapshot{m_Path, projectPath(m_Path), m_ProjectSnapshot, m_Database->fullPath(),
+                          m_DatabaseSnapshot,
+                          m_Database->format() == DB::Database::Format::Binary};
+
+        // Changes made while the snapshot is written mark the project as modified again. The
+        // snapshot itself is still actual
+        setModified(false);
+        m_SnapshotValid = true;
+
+        m_SaveHandled = false;
+        m_SaveFuture = QtConcurrent::run(writeSnapshot, std::move(snapshot));
+
+        auto watcher = new QFutureWatcher<ErrorList>(this);
+        G_CONNECT(watcher, &QFutureWatcherBase::finished, this, &Project::onSaveFinished);
+        G_CONNECT(watcher, &QFutureWatcherBase::finished, watcher, &QObject::deleteLater);
+        watcher->setFuture(m_SaveFuture);
+    }
+
+    /**
+     * @brief Project::onSaveFinished
+     */
+    void Project::onSaveFinished()
+    {
+        // Might be already handled while waiting for the save
+        if (m_SaveHandled || !m_SaveFuture.isFinished())
+            return;
 
-            m_Database->setName(databaseFileName());
-            m_Database->setPath(m_Path);
-            if (!m_Database->save())
-                m_Errors << tr("Cannot save database to file.");
+        // Journal is changed below
+        waitForAutosaved();
+
+        m_SaveHandled = true;
+        m_Errors = m_SaveFuture.result();
+
+        if (m_Errors.isEmpty()) {
+            // Main files contain all changes recorded before the snapshot
+            m_Journal.discard();
+            m_Journal.resetBaseline();
         } else {
-            m_Errors << "Project path is empty.";
+            setModified(true);
+            emit errors(tr("Project save error%1").arg(m_Errors.count() <= 1 ? "" : "s"), m_Errors);
         }
 
-        setModified(!m_Errors.isEmpty());
+        // Records made during the save were dropped as well, or postponed until its end
+        if (std::exchange(m_JournaledDuringSave, false))
+            autosave();
 
-        if (!m_Errors.isEmpty())
-            emit errors(tr("Project save error%1").arg(m_Errors.count() <= 1 ? "" : "s"), m_Errors);
+        emit saved(m_Errors.isEmpty());
+
+        if (std::exchange(m_SaveRequested, false))
+            startSave();
+    }
+
+    /**
+     * @brief Project::autosave
+     * Appends changes made since the last autosave or save to the journal. When the journal
+     * grows too much, it's compacted into the main files by the regular save.
+     * Like on save, only serialization is performed on the GUI thread. Requests made while
+     * the journal is being written are coalesced into one more autosave.
+     */
+    void Project::autosave()
+    {
+        Q_ASSERT(!!m_Database);
+
+        // Journal cannot be replayed without the main files
+        if (m_Path.isEmpty() || !QFile::exists(fullPath()))
+            return;
+
+        if (isAutosaving()) {
+            m_AutosaveRequested = true;
+            return;
+        }
+
+        // Main files are being written, so the saved state cannot be read. The journal is
+        // rebuilt anyway when the save is finished
+        if (isSaving() && !m_Journal.hasBaseline()) {
+            m_JournaledDuringSave = true;
+            return;
+        }
+
+        m_Journal.setFileName(journalPath());
+        updateSnapshot();
+        Snapshot snapshot{m_Path, fullPath(), m_ProjectSnapshot,
+                          DB::Database::mkPath(m_Path, databaseFileName()), m_DatabaseSnapshot,
+                          false /*binaryDatabase*/};
+
+        m_AutosaveDuringSave = isSaving();
+        m_AutosaveHandled = false;
+        m_AutosaveFuture = QtConcurrent::run([journal = &m_Journal, snapshot = std::move(snapshot)] {
+            JournalResult result;
+
+            if (!journal->hasBaseline()) {
+                // The last saved state, only the difference with it is recorded
+                auto project = DB::Binary::readFile(snapshot.projectFile, result.errors);
+                auto database = DB::Binary::readFile(snapshot.databaseFile, result.errors);
+                if (!result.errors.isEmpty())
+                    return result;
+
+                journal->setBaseline(project, database);
+            }
+
+            result.records = journal->record(snapshot.project, snapshot.database);
+            if (!journal->flush())
+                result.errors << Project::tr("Cannot write project journal: %1.")
+                                 .arg(journal->fileName());
+
+            return result;
+        });
+
+        auto watcher = new QFutureWatcher<JournalResult>(this);
+        G_CONNECT(watcher, &QFutureWatcherBase::finished, this, &Project::onAutosaveFinished);
+        G_CONNECT(watcher, &QFutureWatcherBase::finished, watcher, &QObject::deleteLater);
+        watcher->setFuture(m_AutosaveFuture);
+    }
+
+    /**
+     * @brief Project::isAutosaving
+     * @return
+     */
+    bool Project::isAutosaving() const
+    {
+        return !m_AutosaveHandled;
+    }
+
+    /**
+     * @brief Project::waitForAutosaved
+     */
+    void Project::waitForAutosaved()
+    {
+        while (isAutosaving()) {
+            m_AutosaveFuture.waitForFinished();
+            onAutosaveFinished();
+        }
+    }
+
+    /**
+     * @brief Project::onAutosaveFinished
+     */
+    void Project::onAutosaveFinished()
+    {
+        // Might be already handled while waiting for the autosave
+        if (m_AutosaveHandled || !m_AutosaveFuture.isFinished())
+            return;
+
+        m_AutosaveHandled = true;
+        const JournalResult result = m_AutosaveFuture.result();
+
+        // Records made during the save are dropped when it's finished
+        if (std::exchange(m_AutosaveDuringSave, false) && result.records > 0)
+            m_JournaledDuringSave = true;
+
+        if (!result.errors.isEmpty())
+            emit errors(tr("Project autosave error"), result.errors);
+        else if (!isSaving() && m_Journal.size() > journalCompactionSize)
+            save();
+
+        if (std::exchange(m_AutosaveRequested, false))
+            autosave();
+    }
+
+    /**
+     * @brief Project::waitForPendingWrites
+     */
+    void Project::waitForPendingWrites()
+    {
+        // Finished autosave may start a save and vice versa
+        while (isSaving() || isAutosaving()) {
+            waitForAutosaved();
+            waitForSaved();
+        }
+    }
+
+    /**
+     * @brief Project::updateSnapshot
+     * Serializes the project and the database if they are changed since the last snapshot.
+     * JSON objects are implicitly shared, so copies can be passed to another thread.
+     */
+    void Project::updateSnapshot()
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        if (!m_SnapshotValid) {
+            m_ProjectSnapshot = toJson();
+            m_DatabaseSnapshot = m_Database->toJson();
+            m_SnapshotValid = true;
+        }
+
+        m_SnapshotTime = timer.elapsed();
+    }
+
+    /**
+     * @brief Project::invalidateSnapshot
+     */
+    void Project::invalidateSnapshot()
+    {
+        m_SnapshotValid = false;
+    }
+
+    /**
+     * @brief Project::discardJournal
+     * Should be called when unsaved changes are abandoned.
+     */
+    void Project::discardJournal()
+    {
+        waitForAutosaved();
+        m_Journal.setFileName(journalPath());
+        m_Journal.discard();
+        m_Journal.resetBaseline();
     }
 
     /**
@@ -253,6 +587,27 @@ namespace Projects {
         return result;
     }
 
+    /**
+     * @brief Project::binaryDatabase
+     * @return
+     */
+    bool Project::binaryDatabase() const
+    {
+        return m_Database && m_Database->format() == DB::Database::Format::Binary;
+    }
+
+    /**
+     * @brief Project::setBinaryDatabase
+     * @param binary
+     */
+    void Project::setBinaryDatabase(bool binary)
+    {
+        Q_ASSERT(!!m_Database);
+
+        m_Database->setFormat(binary ? DB::Database::Format::Binary : DB::Database::Format::Json);
+        invalidateSnapshot();
+    }
+
     /**
      * @brief Project::toJson
      * @return
@@ -263,6 +618,7 @@ namespace Projects {
 
         result.insert("Name", m_Name);
         result.insert("NextID", m_nextUniqueID.toJson());
+        result.insert("Binary database", binaryDatabase());
 
         return result;
     }
@@ -274,12 +630,17 @@ namespace Projects {
      */
     void Project::fromJson(const QJsonObject &src, QStringList &errorList)
     {
+        invalidateSnapshot();
+
         Util::checkAndSet(src, "Name", errorList, [&src, this](){
             m_Name = src["Name"].toString();
         });
         Util::checkAndSet(src, "NextID", errorList, [&, this](){
             m_nextUniqueID.fromJson(src["NextID"], errorList);
         });
+
+        // Optional, projects without it use JSON database
+        setBinaryDatabase(src["Binary database"].toBool());
     }
 
     /**
@@ -306,6 +667,7 @@ namespace Projects {
      */
     Common::ID Project::genID()
     {
+        invalidateSnapshot();
         return m_nextUniqueID++;
     }
 
@@ -324,6 +686,9 @@ namespace Projects {
      */
     void Project::setModified(bool modified)
     {
+        // Called by each command on undo and redo, even if the status is the same
+        invalidateSnapshot();
+
         if (modified != m_Modified) {
             m_Modified = modified;
 
@@ -368,6 +733,7 @@ namespace Projects {
             return;
 
         m_Name = name;
+        invalidateSnapshot();
         emit nameChanged(name);
     }
 
@@ -413,6 +779,16 @@ namespace Projects {
                    basePath + "/" + projectFileName() + "." + PROJECT_FILE_EXTENTION);
     }
 
+    /**
+     * @brief Project::journalPath
+     * @return
+     */
+    QString Project::journalPath() const
+    {
+        return QDir::toNativeSeparators(
+                   m_Path + "/" + projectFileName() + "." + PROJECT_JOURNAL_EXTENTION);
+    }
+
     /**
      * @brief ScopedProjectSetter::ScopedProjectSetter
      * @param p
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <QObject>
+#include <QFuture>
 #include <QJsonObject>
 
 #include <Common/ID.h>
@@ -38,6 +39,7 @@
 
 #include "types.h"
 #include "ProjectTypes.hpp"
+#include "ProjectJournal.h"
 
 /**
  * @brief project
@@ -77,6 +79,9 @@ namespace Projects {
         DB::SharedDatabase globalDatabase() const;
         bool setGlobalDatabase(const DB::SharedDatabase &database);
 
+        bool binaryDatabase() const;
+        void setBinaryDatabase(bool binary);
+
         QJsonObject toJson() const;
         void fromJson(const QJsonObject &src, QStringList &errorList);
 
@@ -87,12 +92,22 @@ namespace Projects {
 
         bool isModified() const;
 
+        bool isSaving() const;
+        bool waitForSaved();
+        qint64 lastSnapshotTime() const;
+
+        bool isAutosaving() const;
+        void waitForAutosaved();
+
+        void discardJournal();
+
     public slots:
         void setModified(bool modified);
         void setName(const QString &name);
         void setPath(const QString &path);
 
         void save();
+        void autosave();
 
     signals:
         void nameChanged(const QString &name);
@@ -102,13 +117,27 @@ namespace Projects {
 
         void modifiedStatusUpdated(bool modified);
 
+        void saved(bool success);
+
         void scopeAdded(const QString &projectName, const Entity::SharedScope &scope);
         void scopeRemoved(const QString &projectName, const Entity::SharedScope &scope);
 
+        void bulkLoadStarted(const QString &projectName);
+        void bulkLoadFinished(const QString &projectName);
+
     private:
         QString projectFileName() const;
         QString databaseFileName() const;
         QString projectPath(const QString &basePath) const;
+        QString journalPath() const;
+
+        void startSave();
+        void onSaveFinished();
+        void onAutosaveFinished();
+        void waitForPendingWrites();
+
+        void updateSnapshot();
+        void invalidateSnapshot();
 
         QString m_Name;
         QString m_Path;
@@ -122,6 +151,33 @@ namespace Projects {
         ErrorList m_Errors;
 
         Commands::SharedCommandStack m_CommandsStack;
+
+        // Snapshot of the project is written on the worker thread
+        QFuture<ErrorList> m_SaveFuture;
+        bool m_SaveHandled = true;
+        bool m_SaveRequested = false;
+        qint64 m_SnapshotTime = 0; // ms, spent on the GUI thread
+
+        // The last serialized state, shared by save and autosave while it's actual. Every
+        // command updates the modified status of the project, so the state is dropped on it
+        QJsonObject m_ProjectSnapshot;
+        QJsonObject m_DatabaseSnapshot;
+        bool m_SnapshotValid = false;
+
+        // Changes made after the last save, replayed on load after a crash. Changes are
+        // digested and written on the worker thread, the journal is not touched meanwhile
+        struct JournalResult
+        {
+            int records = 0;
+            ErrorList errors;
+        };
+
+        ProjectJournal m_Journal;
+        QFuture<JournalResult> m_AutosaveFuture;
+        bool m_AutosaveHandled = true;
+        bool m_AutosaveRequested = false;
+        bool m_AutosaveDuringSave = false;
+        bool m_JournaledDuringSave = false;
     };
 
     /// Helper for project load. Should be in the header due to Qt Meta system limitation
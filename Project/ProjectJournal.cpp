@@ -0,0 +1,456 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include "ProjectJournal.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QJsonArray>
+#include <QDataStream>
+#include <QJsonDocument>
+#include <QCryptographicHash>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Projects {
+
+    namespace {
+
+        const QByteArray journalMagic = "QUTJ";
+        // Version 1 has no type records, its scope records contain types
+        const quint32 journalVersion = 2;
+        // Magic, version
+        const int headerSize = 8;
+        // Payload size, checksum
+        const int recordHeaderSize = 8;
+
+        const QString opMark = "Op";
+        const QString projectOp = "Project";
+        const QString scopeOp = "Scope";
+        const QString removeScopeOp = "Remove scope";
+        const QString typeOp = "Type";
+        const QString removeTypeOp = "Remove type";
+        const QString relationsOp = "Relations";
+
+        const QString scopesMark = "Scopes";
+        const QString typesMark = "Types";
+        const QString relationsMark = "Relations";
+        const QString idMark = "ID";
+        const QString scopeIdMark = "Scope ID";
+
+        QByteArray digest(const QJsonDocument &doc)
+        {
+            return QCryptographicHash::hash(doc.toJson(QJsonDocument::Compact),
+                                            QCryptographicHash::Md5);
+        }
+
+        QByteArray header()
+        {
+            QByteArray result;
+            QDataStream stream(&result, QIODevice::WriteOnly);
+            stream.writeRawData(journalMagic.constData(), journalMagic.size());
+            stream << journalVersion;
+
+            return result;
+        }
+
+        bool sync(QFile &f)
+        {
+            if (!f.flush())
+                return false;
+#ifdef Q_OS_WIN
+            return ::_commit(f.handle()) == 0;
+#else
+            return ::fsync(f.handle()) == 0;
+#endif
+        }
+
+    } // namespace
+
+    /**
+     * @brief ProjectJournal::ProjectJournal
+     * @param fileName
+     */
+    ProjectJournal::ProjectJournal(QString fileName)
+        : m_FileName(std::move(fileName))
+    {}
+
+    /**
+     * @brief ProjectJournal::fileName
+     * @return
+     */
+    QString ProjectJournal::fileName() const
+    {
+        return m_FileName;
+    }
+
+    /**
+     * @brief ProjectJournal::setFileName
+     * @param fileName
+     */
+    void ProjectJournal::setFileName(const QString &fileName)
+    {
+        m_FileName = fileName;
+    }
+
+    /**
+     * @brief ProjectJournal::hasBaseline
+     * @return
+     */
+    bool ProjectJournal::hasBaseline() const
+    {
+        return m_HasBaseline;
+    }
+
+    /**
+     * @brief ProjectJournal::setBaseline
+     * Sets the state which is already stored on the disk, only changes made after it are recorded.
+     * @param project
+     * @param database
+     */
+    void ProjectJournal::setBaseline(const QJsonObject &project, const QJsonObject &database)
+    {
+        m_Baseline = makeState(project, database);
+        m_HasBaseline = true;
+    }
+
+    /**
+     * @brief ProjectJournal::resetBaseline
+     */
+    void ProjectJournal::resetBaseline()
+    {
+        m_Baseline = State();
+        m_HasBaseline = false;
+    }
+
+    /**
+     * @brief ProjectJournal::record
+     * Adds records for the parts of the state changed since the baseline and makes the state
+     * a new baseline. Records are kept in memory until flush() is called.
+     * @param project
+     * @param database
+     * @return number of added records
+     */
+    int ProjectJournal::record(const QJsonObject &project, const QJsonObject &database)
+    {
+        Q_ASSERT(m_HasBaseline);
+
+        State current;
+        current.project = digest(QJsonDocument(project));
+        current.relations = digest(QJsonDocument(database[relationsMark].toArray()));
+
+        int count = 0;
+
+        if (current.project != m_Baseline.project) {
+            append({{opMark, projectOp}, {projectOp, project}});
+            ++count;
+        }
+
+        for (auto &&value : database[scopesMark].toArray()) {
+            QJsonObject scope = value.toObject();
+            const QString id = scope[idMark].toString();
+
+            QJsonArray types;
+            ScopeState &state = current.scopes[id] = makeScopeState(scope, types);
+
+            auto baseline = m_Baseline.scopes.constFind(id);
+            const bool isNew = baseline == m_Baseline.scopes.cend();
+            if (isNew || baseline->properties != state.properties) {
+                append({{opMark, scopeOp}, {scopeOp, scope}});
+                ++count;
+            }
+
+            for (auto &&typeValue : types) {
+                const QJsonObject type = typeValue.toObject();
+                const QString typeId = type[idMark].toString();
+                if (isNew || baseline->types.value(typeId) != state.types[typeId]) {
+                    append({{opMark, typeOp}, {scopeIdMark, id}, {typeOp, type}});
+                    ++count;
+                }
+            }
+
+            if (!isNew) {
+                for (auto it = baseline->types.cbegin(); it != baseline->types.cend(); ++it) {
+                    if (!state.types.contains(it.key())) {
+                        append({{opMark, removeTypeOp}, {scopeIdMark, id}, {idMark, it.key()}});
+                        ++count;
+                    }
+                }
+            }
+        }
+
+        for (auto it = m_Baseline.scopes.cbegin(); it != m_Baseline.scopes.cend(); ++it) {
+            if (!current.scopes.contains(it.key())) {
+                append({{opMark, removeScopeOp}, {idMark, it.key()}});
+                ++count;
+            }
+        }
+
+        if (current.relations != m_Baseline.relations) {
+            append({{opMark, relationsOp}, {relationsMark, database[relationsMark]}});
+            ++count;
+        }
+
+        m_Baseline = std::move(current);
+
+        return count;
+    }
+
+    /**
+     * @brief ProjectJournal::flush
+     * Appends pending records to the file as a single batch and syncs it to the disk.
+     * @param truncate atomically replace the file content with pending records
+     * @return
+     */
+    bool ProjectJournal::flush(bool truncate)
+    {
+        if (m_Pending.isEmpty())
+            return truncate ? discard() : true;
+
+        if (truncate) {
+            QSaveFile f(m_FileName);
+            if (!f.open(QIODevice::WriteOnly))
+                return false;
+
+            const QByteArray data = header() + m_Pending;
+            if (f.write(data) != data.size() || !f.commit())
+                return false;
+
+            m_Pending.clear();
+            return true;
+        }
+
+        QFile f(m_FileName);
+        if (!f.open(QIODevice::WriteOnly | QIODevice::Append))
+            return false;
+
+        const qint64 oldSize = f.size();
+        QByteArray data = m_Pending;
+        if (oldSize == 0)
+            data.prepend(header());
+
+        if (f.write(data) != data.size() || !sync(f)) {
+            // Don't leave a partially written batch, records after it would be lost on replay
+            f.resize(oldSize);
+            return false;
+        }
+
+        m_Pending.clear();
+        return true;
+    }
+
+    /**
+     * @brief ProjectJournal::discard
+     * Drops all records, e.g. when they are stored in the main files.
+     * @return
+     */
+    bool ProjectJournal::discard()
+    {
+        m_Pending.clear();
+        return !exists() || QFile::remove(m_FileName);
+    }
+
+    /**
+     * @brief ProjectJournal::size
+     * @return size of the file with pending records
+     */
+    qint64 ProjectJournal::size() const
+    {
+        return QFileInfo(m_FileName).size() + m_Pending.size();
+    }
+
+    /**
+     * @brief ProjectJournal::exists
+     * @return
+     */
+    bool ProjectJournal::exists() const
+    {
+        return !m_FileName.isEmpty() && QFile::exists(m_FileName);
+    }
+
+    /**
+     * @brief ProjectJournal::replay
+     * Applies records to the project and database JSON. A torn record at the end of the file
+     * is expected after a crash and is ignored with all data after it.
+     * @param fileName
+     * @param project
+     * @param database
+     * @param errors
+     * @return number of applied records
+     */
+    int ProjectJournal::replay(const QString &fileName, QJsonObject &project,
+                               QJsonObject &database, ErrorList &errors)
+    {
+        QFile f(fileName);
+        if (!f.open(QIODevice::ReadOnly)) {
+            errors << QObject::tr("Cannot read project journal: %1.").arg(fileName);
+            return 0;
+        }
+
+        const QByteArray data = f.readAll();
+        QDataStream stream(data);
+
+        QByteArray magic(journalMagic.size(), '\0');
+        quint32 version = 0;
+        stream.readRawData(magic.data(), magic.size());
+        stream >> version;
+        if (data.size() < headerSize || magic != journalMagic || version < 1 ||
+            version > journalVersion) {
+            errors << QObject::tr("Wrong project journal format: %1.").arg(fileName);
+            return 0;
+        }
+
+        // Scopes without types and their types by ID
+        QHash<QString, QJsonObject> scopes;
+        QHash<QString, QHash<QString, QJsonObject>> types;
+        auto setScope = [&scopes, &types](QJsonObject scope) {
+            const QString id = scope[idMark].toString();
+            if (scope.contains(typesMark)) {
+                auto &scopeTypes = types[id];
+                scopeTypes.clear();
+                for (auto &&type : scope.take(typesMark).toArray()) {
+                    const QJsonObject typeObject = type.toObject();
+                    scopeTypes[typeObject[idMark].toString()] = typeObject;
+                }
+            }
+            scopes[id] = scope;
+        };
+
+        for (auto &&value : database[scopesMark].toArray())
+            setScope(value.toObject());
+
+        int count = 0;
+        qint64 pos = headerSize;
+        while (data.size() - pos >= recordHeaderSize) {
+            quint32 size = 0, checksum = 0;
+            stream >> size >> checksum;
+            if (size > quint64(data.size() - pos - recordHeaderSize))
+                break;
+
+            const char *payload = data.constData() + pos + recordHeaderSize;
+            if (qChecksum(payload, size) != checksum)
+                break;
+
+            stream.skipRawData(int(size));
+            pos += recordHeaderSize + size;
+
+            const QJsonObject record =
+                QJsonDocument::fromJson(QByteArray::fromRawData(payload, int(size))).object();
+            const QString op = record[opMark].toString();
+            if (op == projectOp) {
+                project = record[projectOp].toObject();
+            } else if (op == scopeOp) {
+                setScope(record[scopeOp].toObject());
+            } else if (op == removeScopeOp) {
+                scopes.remove(record[idMark].toString());
+                types.remove(record[idMark].toString());
+            } else if (op == typeOp) {
+                const QJsonObject type = record[typeOp].toObject();
+                types[record[scopeIdMark].toString()][type[idMark].toString()] = type;
+            } else if (op == removeTypeOp) {
+                types[record[scopeIdMark].toString()].remove(record[idMark].toString());
+            } else if (op == relationsOp) {
+                database[relationsMark] = record[relationsMark];
+            } else {
+                errors << QObject::tr("Unknown project journal record: \"%1\".").arg(op);
+                continue;
+            }
+
+            ++count;
+        }
+
+        QJsonArray scopesArray;
+        for (auto it = scopes.begin(); it != scopes.end(); ++it) {
+            QJsonArray typesArray;
+            for (auto &&type : types.value(it.key()))
+                typesArray.append(type);
+
+            it->insert(typesMark, typesArray);
+            scopesArray.append(*it);
+        }
+        database[scopesMark] = scopesArray;
+
+        return count;
+    }
+
+    /**
+     * @brief ProjectJournal::makeState
+     * @param project
+     * @param database
+     * @return
+     */
+    ProjectJournal::State ProjectJournal::makeState(const QJsonObject &project,
+                                                    const QJsonObject &database)
+    {
+        State result;
+        result.project = digest(QJsonDocument(project));
+        result.relations = digest(QJsonDocument(database[relationsMark].toArray()));
+
+        for (auto &&value : database[scopesMark].toArray()) {
+            QJsonObject scope = value.toObject();
+            QJsonArray types;
+            result.scopes[scope[idMark].toString()] = makeScopeState(scope, types);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief ProjectJournal::makeScopeState
+     * @param scope JSON of the scope, types are moved to the types parameter
+     * @param types
+     * @return
+     */
+    ProjectJournal::ScopeState ProjectJournal::makeScopeState(QJsonObject &scope,
+                                                              QJsonArray &types)
+    {
+        types = scope.take(typesMark).toArray();
+
+        ScopeState result;
+        result.properties = digest(QJsonDocument(scope));
+        for (auto &&type : types) {
+            const QJsonObject typeObject = type.toObject();
+            result.types[typeObject[idMark].toString()] = digest(QJsonDocument(typeObject));
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief ProjectJournal::append
+     * @param record
+     */
+    void ProjectJournal::append(const QJsonObject &record)
+    {
+        const QByteArray payload = QJsonDocument(record).toJson(QJsonDocument::Compact);
+
+        QDataStream stream(&m_Pending, QIODevice::WriteOnly | QIODevice::Append);
+        stream << quint32(payload.size()) << quint32(qChecksum(payload.constData(), uint(payload.size())));
+        stream.writeRawData(payload.constData(), payload.size());
+    }
+
+} // namespace Projects
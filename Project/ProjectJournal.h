@@ -0,0 +1,88 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#pragma once
+
+#include <QHash>
+#include <QByteArray>
+#include <QJsonObject>
+
+class QJsonArray;
+
+#include "types.h"
+
+namespace Projects {
+
+    /// Append-only log of the project changes made since the last save. Each record is the
+    /// JSON of a changed type (by ID within its top level scope), scope properties, relations
+    /// or project properties, so the state can be restored after a crash by applying the
+    /// records to the data read from the main files. Nested scopes are a part of the parent
+    /// scope properties. The journal is not thread safe, but it can be used from any thread.
+    class ProjectJournal
+    {
+    public:
+        explicit ProjectJournal(QString fileName = QString());
+
+        QString fileName() const;
+        void setFileName(const QString &fileName);
+
+        bool hasBaseline() const;
+        void setBaseline(const QJsonObject &project, const QJsonObject &database);
+        void resetBaseline();
+
+        int record(const QJsonObject &project, const QJsonObject &database);
+        bool flush(bool truncate = false);
+        bool discard();
+
+        qint64 size() const;
+        bool exists() const;
+
+        static int replay(const QString &fileName, QJsonObject &project, QJsonObject &database,
+                          ErrorList &errors);
+
+    private:
+        // Digests of a top level scope without types and of its types by ID
+        struct ScopeState
+        {
+            QByteArray properties;
+            QHash<QString, QByteArray> types;
+        };
+
+        // Digests of the serialized parts of the project, scopes are identified by ID
+        struct State
+        {
+            QByteArray project;
+            QByteArray relations;
+            QHash<QString, ScopeState> scopes;
+        };
+
+        static State makeState(const QJsonObject &project, const QJsonObject &database);
+        static ScopeState makeScopeState(QJsonObject &scope, QJsonArray &types);
+        void append(const QJsonObject &record);
+
+        QString m_FileName;
+        State m_Baseline;
+        bool m_HasBaseline = false;
+        QByteArray m_Pending;
+    };
+
+} // namespace Projects
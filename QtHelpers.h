@@ -48,6 +48,29 @@
 
 namespace qthelpers
 {
+    /// Calls beginBulkLoad() on construction and endBulkLoad() on destruction
+    template <class Loader>
+    class BulkLoadGuard
+    {
+    public:
+        explicit BulkLoadGuard(Loader *loader) : m_Loader(loader)
+        {
+            if (m_Loader)
+                m_Loader->beginBulkLoad();
+        }
+
+        ~BulkLoadGuard()
+        {
+            if (m_Loader)
+                m_Loader->endBulkLoad();
+        }
+
+        NEITHER_COPIABLE_NOR_MOVABLE(BulkLoadGuard)
+
+    private:
+        Loader *m_Loader;
+    };
+
     namespace details
     {
         template <class Condition>
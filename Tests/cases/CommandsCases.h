@@ -24,13 +24,33 @@
 
 #include "Tests/TestCommands.h"
 
+#include <QImage>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
 #include <Commands/CreateEntity.h>
 #include <Commands/CreateScope.h>
+#include <Commands/EditComponent.h>
 #include <Commands/MakeProjectCurrent.h>
 #include <Commands/MoveGraphicObject.h>
+#include <Commands/ResizeGraphicEntity.h>
+#include <Commands/UndoMemoryLimiter.h>
 #include <Commands/RemoveProject.h>
 #include <Commands/RenameEntity.h>
 #include <Commands/OpenProject.h>
+#include <Commands/ImportDeclarations.h>
+
+#include <DB/ProjectDatabase.h>
+
+#include <Entity/ClassMethod.h>
+#include <Entity/Components/declarationsimporter.h>
+#include <Entity/field.h>
+
+#include <GUI/graphics/Entity.h>
+
+#include <Models/ComponentsModel.h>
+
+#include <Translation/signaturemaker.h>
 
 #include <Project/ProjectDB.hpp>
 #include <Project/ProjectFactory.hpp>
@@ -135,6 +155,179 @@ TEST_F(CommandsTester, MoveGraphicObject)
     ASSERT_EQ(e.pos(), initialPos);
 }
 
+TEST_F(CommandsTester, MergeMoveAndResize)
+{
+    Entity::SharedType someType = std::make_shared<Entity::Type>();
+    Graphics::GraphisEntity e(someType);
+    const QPointF initialPos {0., 0.};
+    const QSizeF initialSize(e.size());
+
+    // Moves of the same objects within one gesture make a single undo step
+    const int gesture = 1;
+    e.setPos(QPointF(10., 10.));
+    m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", initialPos, e.pos(), gesture));
+    e.setPos(QPointF(20., 20.));
+    m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", QPointF(10., 10.), e.pos(),
+                                                          gesture));
+    ASSERT_EQ(m_CommandsStack->count(), 1);
+
+    // The next gesture is a separate step
+    e.setPos(QPointF(30., 30.));
+    m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", QPointF(20., 20.), e.pos(),
+                                                          gesture + 1));
+    ASSERT_EQ(m_CommandsStack->count(), 2);
+
+    // Consecutive resizes of the same entity are merged
+    const QSizeF newSize(initialSize.width() + 50., initialSize.height() + 50.);
+    m_CommandsStack->push(new Commands::ResizeGraphicEntity(e, "", initialSize, initialSize * 1.5));
+    m_CommandsStack->push(new Commands::ResizeGraphicEntity(e, "", initialSize * 1.5, newSize));
+    ASSERT_EQ(m_CommandsStack->count(), 3);
+    ASSERT_EQ(e.size(), newSize);
+
+    m_CommandsStack->undo();
+    EXPECT_EQ(e.size(), initialSize);
+
+    m_CommandsStack->undo();
+    EXPECT_EQ(e.pos(), QPointF(20., 20.));
+
+    m_CommandsStack->undo();
+    EXPECT_EQ(e.pos(), initialPos);
+}
+
+TEST_F(CommandsTester, UndoMemoryLimit)
+{
+    Entity::SharedType someType = std::make_shared<Entity::Type>();
+    Graphics::GraphisEntity e(someType);
+
+    Commands::UndoMemoryLimiter limiter(*m_CommandsStack);
+
+    // Commands without a gesture are not merged
+    m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", QPointF(), QPointF(1., 1.)));
+    m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", QPointF(1., 1.), QPointF(2., 2.)));
+    ASSERT_EQ(m_CommandsStack->count(), 2);
+
+    // Usage is updated on push, merge, undo and redo without a full recount
+    const qint64 usage = limiter.memoryUsage();
+    ASSERT_GT(usage, 0);
+    m_CommandsStack->undo();
+    EXPECT_EQ(limiter.memoryUsage(), usage);
+    m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", QPointF(1., 1.), QPointF(3., 3.)));
+    ASSERT_EQ(m_CommandsStack->count(), 2);
+    EXPECT_EQ(limiter.memoryUsage(), usage);
+
+    int droppedCount = 0, undoLimit = 0;
+    G_CONNECT(&limiter, &Commands::UndoMemoryLimiter::historyTrimmed,
+              [&](int count, int limit) { droppedCount += count; undoLimit = limit; });
+
+    // History is dropped and the stack keeps only the commands which fit into the limit
+    limiter.setMemoryLimit(usage);
+    m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", QPointF(3., 3.), QPointF(4., 4.)));
+    EXPECT_EQ(droppedCount, 3);
+    EXPECT_EQ(undoLimit, 2);
+    EXPECT_EQ(m_CommandsStack->undoLimit(), 2);
+    EXPECT_EQ(m_CommandsStack->count(), 0);
+    EXPECT_EQ(limiter.memoryUsage(), 0);
+    EXPECT_EQ(e.pos(), QPointF(4., 4.));
+
+    // Then the oldest commands are dropped by the stack itself
+    for (int i = 5; i < 8; ++i)
+        m_CommandsStack->push(new Commands::MoveGraphicObject(e, "", QPointF(i - 1, i - 1),
+                                                              QPointF(i, i)));
+    EXPECT_EQ(m_CommandsStack->count(), 2);
+    EXPECT_LE(limiter.memoryUsage(), limiter.memoryLimit());
+
+    m_CommandsStack->undo();
+    m_CommandsStack->undo();
+    EXPECT_FALSE(m_CommandsStack->canUndo());
+    EXPECT_EQ(e.pos(), QPointF(5., 5.));
+}
+
+TEST_F(CommandsTester, EntityContentCache)
+{
+    auto someClass = std::make_shared<Entity::Class>("Some", Common::ID::nullID());
+    auto method = someClass->makeMethod("foo");
+    auto field = someClass->addField("value", Common::ID::nullID());
+
+    Graphics::GraphisEntity e(someClass);
+    QImage image(e.boundingRect().size().toSize(), QImage::Format_ARGB32);
+    auto paint = [&] {
+        QPainter painter(&image);
+        QStyleOptionGraphicsItem option;
+        e.paint(&painter, &option);
+    };
+
+    paint();
+    ASSERT_EQ(e.contentLines().filter("foo").count(), 1);
+
+    // Components are edited in place, the lists of the class stay the same
+    method->setName("bar");
+    field->setName("count");
+    paint();
+    EXPECT_TRUE(e.contentLines().filter("foo").isEmpty());
+    EXPECT_EQ(e.contentLines().filter("bar").count(), 1);
+    EXPECT_EQ(e.contentLines().filter("count").count(), 1);
+}
+
+TEST_F(CommandsTester, EditComponent)
+{
+    auto someClass = m_ProjectScope->addType<Entity::Class>("Some");
+    auto field = someClass->addField("value", m_GlobalDb->typeByName("int")->id());
+
+    auto model = std::make_shared<Models::ComponentsModel>(someClass);
+    model->setSignatureMaker(std::make_unique<Translation::SignatureMaker>(
+                                 m_GlobalDb, m_ProjectDb, m_ProjectScope, someClass));
+    model->setDisplay(Models::DisplayPart::Fields);
+
+    auto newField = std::make_shared<Entity::Field>(*field);
+    newField->setName("count");
+    newField->setPrefix("m_");
+
+    const auto index = model->index(0, Models::ComponentsModel::ShortSignature);
+    m_CommandsStack->push(new Commands::EditComponent(model, index, newField));
+    EXPECT_EQ(field->name(), "count");
+    EXPECT_EQ(field->prefix(), "m_");
+    EXPECT_TRUE(model->data(index, Qt::DisplayRole).toString().contains("m_count"));
+
+    // The same component object is changed back and forth
+    m_CommandsStack->undo();
+    EXPECT_EQ(someClass->fields().first(), field);
+    EXPECT_EQ(field->name(), "value");
+    EXPECT_TRUE(field->prefix().isEmpty());
+
+    m_CommandsStack->redo();
+    EXPECT_EQ(field->name(), "count");
+    EXPECT_EQ(field->prefix(), "m_");
+}
+
+TEST_F(CommandsTester, ComponentsModelSignatures)
+{
+    auto someClass = m_ProjectScope->addType<Entity::Class>("Some");
+    auto usedClass = m_ProjectScope->addType<Entity::Class>("Used");
+    auto field = someClass->addField("value", usedClass->id());
+
+    auto model = std::make_shared<Models::ComponentsModel>(someClass);
+    model->setSignatureMaker(std::make_unique<Translation::SignatureMaker>(
+                                 m_GlobalDb, m_ProjectDb, m_ProjectScope, someClass));
+    model->setDisplay(Models::DisplayPart::Fields);
+
+    const auto index = model->index(0, Models::ComponentsModel::ShortSignature);
+    auto signature = [&] { return model->data(index, Qt::DisplayRole).toString(); };
+    ASSERT_TRUE(signature().contains("Used"));
+
+    // Cached signature is rebuilt after in-place changes
+    field->setPrefix("m_");
+    EXPECT_TRUE(signature().contains("m_value"));
+
+    field->setTypeId(m_GlobalDb->typeByName("int")->id());
+    EXPECT_TRUE(signature().contains("int"));
+
+    // And after renaming of a used type
+    field->setTypeId(usedClass->id());
+    usedClass->setName("Renamed");
+    EXPECT_TRUE(signature().contains("Renamed"));
+    EXPECT_FALSE(signature().contains("Used"));
+}
+
 TEST_F(CommandsTester, RemoveProject)
 {
     auto createEntityCmd = std::make_unique<Commands::CreateEntity>(
@@ -177,6 +370,7 @@ TEST_F(CommandsTester, OpenProject)
     auto tstProject = std::make_shared<Projects::Project>("MyTstProject", QDir::currentPath());
     tstProject->setGlobalDatabase(m_GlobalDb);
     tstProject->save();
+    tstProject->waitForSaved();
 
     auto currentProject = m_FakeAppModel->currentProject();
 
@@ -189,3 +383,116 @@ TEST_F(CommandsTester, OpenProject)
     ASSERT_NE(currentProject, newCurrentProject);
     ASSERT_EQ(newCurrentProject->fullPath(), tstProject->fullPath());
 }
+
+TEST_F(CommandsTester, SceneEntitiesGrid)
+{
+    auto createEntityCmd = std::make_unique<Commands::CreateEntity>(
+        Entity::KindOfType::Class, Common::ID::projectScopeID(), QPointF(10, 20));
+    createEntityCmd->redoImpl();
+
+    auto entity = createEntityCmd->graphicsEntity();
+    ASSERT_TRUE(!!entity);
+    EXPECT_EQ(m_Scene->entityAt(QPointF(10, 20)), entity.data());
+
+    // Grid is updated lazily, but before any lookup
+    entity->setPos(QPointF(1000, 2000));
+    EXPECT_EQ(m_Scene->entityAt(QPointF(10, 20)), nullptr);
+    EXPECT_EQ(m_Scene->entityAt(QPointF(1000, 2000)), entity.data());
+
+    m_Scene->removeItem(entity.data());
+    EXPECT_EQ(m_Scene->entityAt(QPointF(1000, 2000)), nullptr);
+
+    m_Scene->addItem(entity.data());
+    EXPECT_EQ(m_Scene->entityAt(QPointF(1000, 2000)), entity.data());
+}
+
+TEST_F(CommandsTester, ImportDeclarations)
+{
+    const QString header =
+        "#include <QString>\n"
+        "namespace app {\n"
+        "    /// Foo class\n"
+        "    class Foo : public Bar\n"
+        "    {\n"
+        "        Q_OBJECT\n"
+        "    public:\n"
+        "        explicit Foo(int a = 0);\n"
+        "        ~Foo() override;\n"
+        "        const QString &name() const;\n"
+        "        void setName(const QString &name) { m_Name = name; }\n"
+        "    signals:\n"
+        "        void nameChanged(const QString &name);\n"
+        "    private:\n"
+        "        QString m_Name; /* name */\n"
+        "        int m_Count = 0;\n"
+        "    };\n"
+        "    struct Baz { double value; };\n"
+        "}\n";
+
+    Components::DeclarationsImporter importer({m_ProjectDb, m_GlobalDb}, m_ProjectScope->id());
+    ASSERT_TRUE(importer.import(header)) << importer.errors().join("; ").toStdString();
+
+    auto stats = importer.statistics();
+    EXPECT_EQ(stats.lines, 19);
+    EXPECT_EQ(stats.classes, 2);
+    EXPECT_EQ(stats.components, 6);
+    EXPECT_EQ(stats.errors, 0);
+
+    auto types = importer.types();
+    ASSERT_GE(types.count(), 2);
+
+    auto foo = std::dynamic_pointer_cast<Entity::Class>(types[0]);
+    ASSERT_TRUE(!!foo);
+    EXPECT_EQ(foo->name(), "Foo");
+    EXPECT_EQ(foo->kind(), Entity::ClassType);
+    ASSERT_EQ(foo->methods().count(), 3);
+    ASSERT_EQ(foo->fields().count(), 2);
+
+    auto name = foo->methods()[0];
+    EXPECT_EQ(name->name(), "name");
+    EXPECT_TRUE(name->isConst());
+    EXPECT_TRUE(name->returnTypeId().isValid());
+    EXPECT_TRUE(foo->methods()[2]->isSignal());
+    EXPECT_EQ(foo->methods()[1]->parameters()[0]->typeId(), name->returnTypeId());
+    EXPECT_EQ(foo->fields()[0]->section(), Entity::Private);
+
+    auto baz = std::dynamic_pointer_cast<Entity::Class>(types[1]);
+    ASSERT_TRUE(!!baz);
+    EXPECT_EQ(baz->kind(), Entity::StructType);
+    ASSERT_EQ(baz->fields().count(), 1);
+    EXPECT_EQ(baz->fields()[0]->section(), Entity::Public);
+
+    auto cmd = std::make_unique<Commands::ImportDeclarations>(importer, m_ProjectScope,
+                                                              nullptr, QString());
+    cmd->redoImpl();
+    for (auto &&type : types)
+        EXPECT_TRUE(m_ProjectScope->containsType(type->id()));
+
+    // Existing modified types are reused, nested classes are skipped
+    Components::DeclarationsImporter other({m_ProjectDb, m_GlobalDb}, m_ProjectScope->id());
+    ASSERT_TRUE(other.import("class Qux {\n"
+                             "public:\n"
+                             "    const QString &title() const;\n"
+                             "    struct Inner { int value; };\n"
+                             "    QString m_Title;\n"
+                             "};\n")) << other.errors().join("; ").toStdString();
+    EXPECT_EQ(other.statistics().classes, 1);
+    EXPECT_EQ(other.statistics().components, 2);
+
+    auto otherTypes = other.types();
+    ASSERT_EQ(otherTypes.count(), 1);
+
+    auto qux = std::dynamic_pointer_cast<Entity::Class>(otherTypes[0]);
+    ASSERT_TRUE(!!qux);
+    ASSERT_EQ(qux->methods().count(), 1);
+    ASSERT_EQ(qux->fields().count(), 1);
+    EXPECT_EQ(qux->methods()[0]->returnTypeId(), name->returnTypeId());
+    EXPECT_EQ(qux->fields()[0]->typeId(), foo->fields()[0]->typeId());
+
+    cmd->undoImpl();
+    for (auto &&type : types)
+        EXPECT_FALSE(m_ProjectScope->containsType(type->id()));
+
+    EXPECT_FALSE(importer.import("class A { int a[3]; };"));
+    EXPECT_EQ(importer.errors().count(), 1);
+}
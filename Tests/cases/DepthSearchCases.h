@@ -22,6 +22,11 @@
 *****************************************************************************/
 #pragma once
 
+#include <QTemporaryDir>
+#include <QJsonArray>
+
+#include <DB/BinaryFormat.h>
+
 #include "Tests/TestDepthSearch.h"
 #include "Tests/helpers.h"
 
@@ -59,3 +64,197 @@ TEST_F(DepthSearch, ChainScopeSearch)
     ASSERT_EQ(sc3, _scopes["sc3"])
             << "Scopes sc1 should be found in database: sc1::sc2::sc3.";
 }
+
+TEST_F(DepthSearch, TypeSearchByName)
+{
+    for (auto &&name : _types.keys())
+        EXPECT_EQ(m_ProjectDb->typeByName(name), _types[name])
+                << "typeByName() should find type " << name.toStdString();
+
+    EXPECT_EQ(m_ProjectDb->typeByName("sc1::sc2::sc3::Baz"), _types["Baz"])
+            << "typeByName() should find type by qualified name.";
+    EXPECT_EQ(m_ProjectDb->typeByName("sc1::Baz"), nullptr)
+            << "typeByName() shouldn't find type in the wrong scope.";
+}
+
+TEST_F(DepthSearch, TypeIndexFollowsChanges)
+{
+    auto baz = _types["Baz"];
+    baz->setName("Qux");
+    EXPECT_EQ(m_ProjectDb->typeByName("Baz"), nullptr)
+            << "Old name should be removed from the index.";
+    EXPECT_EQ(m_ProjectDb->typeByName("Qux"), baz)
+            << "New name should be added to the index.";
+
+    auto oldId = baz->id();
+    baz->setId(Helpers::GeneratorID::instance().genID());
+    EXPECT_EQ(m_ProjectDb->typeByID(oldId), nullptr)
+            << "Old ID should be removed from the index.";
+    EXPECT_EQ(m_ProjectDb->typeByID(baz->id()), baz)
+            << "New ID should be added to the index.";
+
+    auto newType = _scopes["sc5"]->addType("Quux");
+    EXPECT_EQ(m_ProjectDb->typeByID(newType->id()), newType)
+            << "Type added to the nested scope should be indexed.";
+
+    _scopes["sc2"]->removeChildScope(_scopes["sc3"]->id());
+    EXPECT_EQ(m_ProjectDb->typeByID(baz->id()), nullptr)
+            << "Types from the removed scope should be removed from the index.";
+
+    _scopes["sc1"]->removeType(_types["Foo"]->id());
+    EXPECT_EQ(m_ProjectDb->typeByName("Foo"), nullptr)
+            << "Removed type shouldn't be found.";
+}
+
+TEST_F(DepthSearch, ScopeIndexFollowsChanges)
+{
+    EXPECT_EQ(m_ProjectDb->parentScopeID(_scopes["sc3"]->id()), _scopes["sc2"]->id())
+            << "Parent of sc3 should be sc2.";
+    EXPECT_EQ(m_ProjectDb->parentScopeID(_scopes["sc1"]->id()), Common::ID::globalScopeID())
+            << "Parent of the top level scope should be the global scope.";
+
+    auto sc2 = _scopes["sc2"];
+    auto oldId = sc2->id();
+    sc2->setId(Helpers::GeneratorID::instance().genID());
+    EXPECT_EQ(m_ProjectDb->scope(oldId, true), nullptr)
+            << "Old scope ID should be removed from the index.";
+    EXPECT_EQ(m_ProjectDb->scope(sc2->id(), true), sc2)
+            << "New scope ID should be added to the index.";
+    EXPECT_EQ(m_ProjectDb->parentScopeID(_scopes["sc3"]->id()), sc2->id())
+            << "Back-link of the nested scope should be updated.";
+
+    auto sc6 = m_ProjectDb->addScope("sc6", _scopes["sc3"]->id());
+    ASSERT_TRUE(!!sc6);
+    EXPECT_EQ(m_ProjectDb->scope(sc6->id(), true), sc6)
+            << "Scope added to the nested scope should be found.";
+
+    _scopes["sc1"]->removeChildScope(sc2->id());
+    EXPECT_EQ(m_ProjectDb->scope(sc6->id(), true), nullptr)
+            << "Scopes from the removed subtree shouldn't be found.";
+}
+
+TEST_F(DepthSearch, LazyLoading)
+{
+    auto lazy = std::make_shared<DB::Database>(m_GlobalDb->name(), m_GlobalDb->path());
+    auto eager = std::make_shared<DB::Database>(m_GlobalDb->name(), m_GlobalDb->path());
+    eager->setLoadMode(DB::Database::LoadMode::Eager);
+
+    // Scopes are announced with the loaded name and ID
+    QObject context;
+    QVector<Common::ID> announced;
+    QObject::connect(lazy.get(), &DB::Database::scopeAdded, &context,
+                     [&](const Entity::SharedScope &scope) { announced << scope->id(); });
+
+    ErrorList errors;
+    lazy->load(errors);
+    eager->load(errors);
+    ASSERT_TRUE(errors.isEmpty());
+
+    ASSERT_FALSE(announced.isEmpty());
+    for (auto &&id : announced)
+        EXPECT_TRUE(!!eager->scope(id, true /*searchInDepth*/));
+
+    auto eagerInt = eager->typeByName("int");
+    ASSERT_TRUE(!!eagerInt);
+
+    auto lazyInt = lazy->typeByID(eagerInt->id());
+    ASSERT_TRUE(!!lazyInt) << "Type should be created on the first access.";
+    EXPECT_TRUE(lazyInt->isEqual(*eagerInt));
+    EXPECT_EQ(lazy->typeByName("int"), lazyInt)
+            << "Created type should be added to the index.";
+
+    auto eagerScope = eager->scope(Common::ID::globalScopeID());
+    auto lazyScope = lazy->scope(Common::ID::globalScopeID());
+    ASSERT_TRUE(eagerScope && lazyScope);
+    ASSERT_EQ(lazyScope->types().count(), eagerScope->types().count())
+            << "All types of the scope should be created on the scope access.";
+
+    for (auto &&type : eagerScope->types()) {
+        auto lazyType = lazy->typeByID(type->id());
+        ASSERT_TRUE(!!lazyType);
+        EXPECT_TRUE(lazyType->isEqual(*type))
+                << "Type " << type->name().toStdString() << " should be the same.";
+    }
+}
+
+TEST_F(DepthSearch, BinaryLazyLoading)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    auto eager = std::make_shared<DB::Database>(m_GlobalDb->name(), m_GlobalDb->path());
+    eager->setLoadMode(DB::Database::LoadMode::Eager);
+
+    ErrorList errors;
+    eager->load(errors);
+    ASSERT_TRUE(errors.isEmpty());
+
+    auto snapshot = std::make_shared<DB::Database>(m_GlobalDb->name(), dir.path());
+    ASSERT_TRUE(DB::Binary::writeFile(eager->toJson(), snapshot->fullPath(), true /*binary*/));
+
+    snapshot->load(errors);
+    ASSERT_TRUE(errors.isEmpty());
+    EXPECT_EQ(snapshot->format(), DB::Database::Format::Binary);
+
+    auto eagerInt = eager->typeByName("int");
+    ASSERT_TRUE(!!eagerInt);
+    auto snapshotInt = snapshot->typeByName("int");
+    ASSERT_TRUE(!!snapshotInt) << "Type should be created from the binary record.";
+    EXPECT_TRUE(snapshotInt->isEqual(*eagerInt));
+
+    EXPECT_EQ(snapshot->toJson(), eager->toJson());
+}
+
+TEST_F(DepthSearch, LazyLoadingBrokenType)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    auto eager = std::make_shared<DB::Database>(m_GlobalDb->name(), m_GlobalDb->path());
+    eager->setLoadMode(DB::Database::LoadMode::Eager);
+
+    ErrorList errors;
+    eager->load(errors);
+    ASSERT_TRUE(errors.isEmpty());
+
+    // Break the kind of type of "int"
+    auto eagerInt = eager->typeByName("int");
+    ASSERT_TRUE(!!eagerInt);
+    const QString intId = eagerInt->id().toJson().toString();
+
+    QJsonObject json = eager->toJson();
+    QJsonArray scopes = json["Scopes"].toArray();
+    QJsonObject brokenType;
+    for (auto &&scopeValue : scopes) {
+        QJsonObject scope = scopeValue.toObject();
+        QJsonArray types = scope["Types"].toArray();
+        for (auto &&typeValue : types) {
+            QJsonObject type = typeValue.toObject();
+            if (type["ID"].toString() == intId) {
+                type[Entity::Type::kindMarker()] = 999;
+                brokenType = type;
+                typeValue = type;
+            }
+        }
+        scope["Types"] = types;
+        scopeValue = scope;
+    }
+    json["Scopes"] = scopes;
+    ASSERT_FALSE(brokenType.isEmpty());
+
+    auto lazy = std::make_shared<DB::Database>(m_GlobalDb->name(), dir.path());
+    ASSERT_TRUE(DB::Binary::writeFile(json, lazy->fullPath(), false /*binary*/));
+
+    lazy->load(errors);
+    ASSERT_TRUE(errors.isEmpty());
+
+    EXPECT_EQ(lazy->typeByID(eagerInt->id()), nullptr);
+    EXPECT_FALSE(lazy->lastErrors().isEmpty())
+            << "Type creation error should be reported.";
+
+    bool saved = false;
+    for (auto &&scopeValue : lazy->toJson()["Scopes"].toArray())
+        for (auto &&typeValue : scopeValue.toObject()["Types"].toArray())
+            saved = saved || typeValue.toObject() == brokenType;
+    EXPECT_TRUE(saved) << "Data of the broken type should be saved unchanged.";
+}
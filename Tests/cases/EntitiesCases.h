@@ -27,6 +27,7 @@
 #include <range/v3/algorithm/equal.hpp>
 
 #include <Entity/Property.h>
+#include <Entity/GraphicEntityData.h>
 
 #include "Constants.h"
 
@@ -60,6 +61,25 @@ TEST_F(Enteties, SimpleType)
     test_copy_move(Type, _type)
 }
 
+TEST_F(Enteties, TypeGraphicsData)
+{
+    ErrorList errors;
+    Entity::Type loaded;
+    loaded.fromJson(_type->toJson(), errors);
+    ASSERT_TRUE(errors.isEmpty());
+    EXPECT_EQ(loaded, *_type);
+
+    // Copies share graphics data even if it's allocated later
+    Entity::Type copy(*_type);
+    _type->graphicEntityData()->setPos(QPointF(10., 20.));
+    EXPECT_EQ(copy.graphicEntityData()->pos(), QPointF(10., 20.));
+
+    loaded.fromJson(_type->toJson(), errors);
+    ASSERT_TRUE(errors.isEmpty());
+    EXPECT_EQ(loaded.graphicEntityData()->pos(), QPointF(10., 20.));
+    EXPECT_EQ(loaded, *_type);
+}
+
 TEST_F(Enteties, ExtendedType)
 {
     ASSERT_STREQ(_extendedType->name().toStdString().c_str(), "Alias");
@@ -24,8 +24,11 @@
 
 #include "Tests/TestJson.h"
 
+#include <QJsonDocument>
+
 #include <Entity/TemplateClass.h>
 #include <Entity/ExtendedType.h>
+#include <DB/BinaryFormat.h>
 
 TEST_F(FileJson, TypeJson)
 {
@@ -256,3 +259,32 @@ TEST_F(FileJson, RealizationRelation)
         relation->addMethods(methods);
     })
 }
+
+TEST_F(FileJson, BinaryDatabase)
+{
+    auto json = m_GlobalDb->toJson();
+
+    ErrorList errors;
+    auto binary = DB::Binary::toBinary(json);
+    ASSERT_TRUE(DB::Binary::isBinary(binary));
+    EXPECT_EQ(DB::Binary::fromBinary(binary, errors), json);
+    ASSERT_TRUE(errors.isEmpty());
+
+    EXPECT_LT(binary.size(), QJsonDocument(json).toJson(QJsonDocument::Compact).size());
+
+    DB::Binary::fromBinary(binary.left(binary.size() / 2), errors);
+    EXPECT_FALSE(errors.isEmpty()) << "Truncated data should be rejected.";
+
+    // Format is detected on loading
+    DB::Database db(*m_GlobalDb);
+    db.setPath(m_RootPath);
+    db.setFormat(DB::Database::Format::Binary);
+    ASSERT_TRUE(db.save());
+
+    auto loaded = std::make_shared<DB::Database>(m_GlobalDb->name(), m_RootPath);
+    errors.clear();
+    loaded->load(errors);
+    ASSERT_TRUE(errors.isEmpty());
+    EXPECT_EQ(loaded->format(), DB::Database::Format::Binary);
+    EXPECT_EQ(loaded->toJson(), json);
+}
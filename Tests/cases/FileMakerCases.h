@@ -82,3 +82,34 @@ TEST_F(FileMaker, MakeFileStructure)
     f.close();
 }
 
+TEST_F(FileMaker, SkipUnchangedFiles)
+{
+    m_Directory.setPath(m_RootPath + m_Sep + "dir_name");
+    auto file = m_Directory.addFile("foo.h");
+    file->setData("#pragma once\n");
+    m_Directory.write();
+    ASSERT_TRUE(m_Errors->isEmpty());
+
+    QFileInfo info(file->path());
+    auto created = info.lastModified();
+    EXPECT_FALSE(file->isChanged());
+
+    // Make sure that rewriting would change modification time
+    QFile f(file->path());
+    ASSERT_TRUE(f.open(QIODevice::ReadWrite));
+    ASSERT_TRUE(f.setFileTime(created.addSecs(-60), QFileDevice::FileModificationTime));
+    f.close();
+
+    m_Directory.write();
+    info.refresh();
+    EXPECT_EQ(info.lastModified(), created.addSecs(-60))
+            << "Unchanged file should not be written.";
+
+    file->setData("#pragma once\n\nclass Foo {};\n");
+    EXPECT_TRUE(file->isChanged());
+    m_Directory.write();
+    info.refresh();
+    EXPECT_NE(info.lastModified(), created.addSecs(-60))
+            << "Changed file should be written.";
+    EXPECT_TRUE(m_Errors->isEmpty());
+}
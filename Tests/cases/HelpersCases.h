@@ -26,6 +26,9 @@
 
 #include <DB/Database.h>
 
+#include <Common/BasicElement.h>
+#include <Common/StringPool.h>
+
 #include "Constants.h"
 
 TEST(DBPath, TestSplit)
@@ -47,3 +50,40 @@ TEST(DBPath, TestJoin)
 
     ASSERT_EQ(path, QString("/foo/bar/baz.%1").arg(DATABASE_FILE_EXTENTION));
 }
+
+TEST(StringPool, Intern)
+{
+    const QString a = Common::intern(QString("some") + QString("Identifier"));
+    const QString b = Common::intern(QString("someIdentifier"));
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.constData(), b.constData());
+
+    // Names of elements share the data
+    Common::BasicElement element(QString("someIdentifier"));
+    EXPECT_EQ(element.name().constData(), a.constData());
+
+    // Names are interned on load only, not on every edit
+    element.setName(QString("otherIdentifier"));
+    EXPECT_NE(element.name().constData(), Common::intern("otherIdentifier").constData());
+
+    ErrorList errors;
+    element.fromJson(element.toJson(), errors);
+    ASSERT_TRUE(errors.isEmpty());
+    EXPECT_EQ(element.name().constData(), Common::intern("otherIdentifier").constData());
+}
+
+TEST(StringPool, Purge)
+{
+    const QString kept = Common::intern(QString("keptIdentifier"));
+    Common::intern(QString("droppedIdentifier"));
+
+    Common::StringPool::instance().purge();
+    const int count = Common::StringPool::instance().count();
+
+    // Only strings used outside of the pool survive
+    EXPECT_EQ(Common::intern(QString("keptIdentifier")).constData(), kept.constData());
+    EXPECT_EQ(Common::StringPool::instance().count(), count);
+
+    Common::intern(QString("droppedIdentifier"));
+    EXPECT_EQ(Common::StringPool::instance().count(), count + 1);
+}
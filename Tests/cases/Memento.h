@@ -24,10 +24,36 @@
 
 #include <gtest/gtest.h>
 
+#include <QJsonDocument>
+#include <QUndoStack>
+
 #include <Common/Memento.hpp>
+#include <Common/MementoDelta.hpp>
 #include <Common/BasicElement.h>
 
+#include <Commands/MementoCmd.hpp>
+
 #include <Entity/Class.h>
+#include <Entity/field.h>
+
+namespace {
+
+    /// Counts exports of the state
+    class CountingField : public Entity::Field
+    {
+    public:
+        using Entity::Field::Field;
+
+        Common::UniqueMemento exportState() const override
+        {
+            ++exports;
+            return Entity::Field::exportState();
+        }
+
+        mutable int exports = 0;
+    };
+
+} // namespace
 
 TEST(MementoTest, SimpleConstruction)
 {
@@ -122,3 +148,103 @@ TEST(MementoTest, RestoreClass_Success)
     ASSERT_EQ(cl->exportState()->json(), memento->json());
     ASSERT_EQ(*cl, *tmpCl);
 }
+
+TEST(MementoTest, Delta_Class)
+{
+    auto cl = makeTstClass();
+    const auto before = cl->toJson();
+
+    cl->makeMethod("getBaz");
+    const auto after = cl->toJson();
+
+    auto delta = Common::MementoDelta::make(before, after);
+    ASSERT_FALSE(delta.isEmpty());
+    ASSERT_LT(delta.footprint(), QJsonDocument(after).toJson(QJsonDocument::Compact).size());
+
+    QStringList errors;
+    ASSERT_EQ(delta.apply(before, errors), after);
+    ASSERT_TRUE(errors.isEmpty());
+
+    auto backDelta = Common::MementoDelta::make(after, before);
+    ASSERT_EQ(backDelta.apply(after, errors), before);
+    ASSERT_TRUE(errors.isEmpty());
+
+    ASSERT_TRUE(Common::MementoDelta::make(after, after).isEmpty());
+}
+
+TEST(MementoTest, DeltaCommand_UndoRedo)
+{
+    std::shared_ptr<Entity::Class> cl = makeTstClass();
+    const auto before = cl->toJson();
+
+    Commands::Memento cmd(cl);
+    cl->setFinalStatus(true);
+    const auto after = cl->toJson();
+
+    cmd.redo();
+    ASSERT_EQ(cl->toJson(), after);
+
+    cmd.undo();
+    ASSERT_EQ(cl->toJson(), before);
+
+    cmd.redo();
+    ASSERT_EQ(cl->toJson(), after);
+}
+
+TEST(MementoTest, DeltaCommand_KeptStateIsDroppedOnChange)
+{
+    auto field = std::make_shared<Entity::Field>("foo", Common::ID(42));
+    field->setPrefix("m_");
+
+    Commands::Memento cmd(field);
+    field->setPrefix("p_");
+    cmd.redo();
+
+    // Not tracked by the command, must survive undo
+    field->setName("bar");
+
+    cmd.undo();
+    EXPECT_EQ(field->prefix(), "m_");
+    EXPECT_EQ(field->name(), "bar");
+
+    cmd.redo();
+    EXPECT_EQ(field->prefix(), "p_");
+    EXPECT_EQ(field->name(), "bar");
+}
+
+TEST(MementoTest, DeltaCommand_StateKeeperPerStack)
+{
+    QUndoStack stack;
+    QUndoStack otherStack;
+    auto keeper = Commands::MementoStateKeeper::attach(stack);
+    ASSERT_EQ(Commands::MementoStateKeeper::attach(stack), keeper);
+    ASSERT_NE(Commands::MementoStateKeeper::attach(otherStack), keeper);
+
+    auto field = std::make_shared<CountingField>("foo", Common::ID(42));
+
+    auto cmd = new Commands::Memento(field, keeper);
+    field->setPrefix("m_");
+    stack.push(cmd);
+    ASSERT_EQ(field->exports, 2);
+
+    // The state made by the previous command is used as the initial one
+    cmd = new Commands::Memento(field, keeper);
+    field->setName("bar");
+    stack.push(cmd);
+    EXPECT_EQ(field->exports, 3);
+
+    stack.undo();
+    stack.redo();
+    stack.undo();
+    stack.undo();
+    EXPECT_EQ(field->exports, 3);
+    EXPECT_EQ(field->prefix(), "");
+    EXPECT_EQ(field->name(), "foo");
+
+    // Changes made outside of the stack drop the kept state
+    field->setSuffix("_");
+    stack.redo();
+    EXPECT_EQ(field->exports, 4);
+    EXPECT_EQ(field->prefix(), "m_");
+    EXPECT_EQ(field->suffix(), "_");
+}
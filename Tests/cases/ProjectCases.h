@@ -22,13 +22,21 @@
 *****************************************************************************/
 #pragma once
 
+#include <QFile>
+
 #include "Tests/TestProject.h"
 #include "Constants.h"
 
+#include <Entity/Class.h>
+#include <Models/BasicTreeItem.h>
+#include <Models/ProjectTreeModel.h>
+
 TEST_F(TestProjects, LoadSaveProject)
 {
     m_Project->database()->addScope("foo")->addType("bar");
     m_Project->save();
+    EXPECT_TRUE(m_Project->waitForSaved());
+    EXPECT_GE(m_Project->lastSnapshotTime(), 0);
 
     EXPECT_FALSE(m_Project->isModified())
         << "Project should be saved.";
@@ -50,3 +58,192 @@ TEST_F(TestProjects, LoadSaveProject)
     EXPECT_EQ(*oldProject, *m_Project)
             << "Saved and loaded projects must be equal";
 }
+
+TEST_F(TestProjects, AsyncSaveCoalescing)
+{
+    int savedCount = 0;
+    QObject context;
+    QObject::connect(m_Project.get(), &Projects::Project::saved, &context,
+                     [&](bool success) { EXPECT_TRUE(success); ++savedCount; });
+
+    m_Project->save();
+    EXPECT_TRUE(m_Project->isSaving());
+
+    // Both requests are coalesced into one more save of the latest state
+    m_Project->save();
+    m_Project->database()->addScope("foo");
+    m_Project->save();
+
+    EXPECT_TRUE(m_Project->waitForSaved());
+    EXPECT_FALSE(m_Project->isSaving());
+    EXPECT_EQ(savedCount, 2);
+
+    auto name = m_Project->name();
+    setProject(std::make_shared<Projects::Project>("no name here ", "no path here"));
+    m_Project->load(rootPath_ + sep_ + name.toLower().replace(" ", "_") +
+                    "." + PROJECT_FILE_EXTENTION);
+
+    EXPECT_FALSE(m_Project->hasErrors());
+    EXPECT_TRUE(!!m_Project->database()->chainScopeSearch({"foo"}));
+}
+
+TEST_F(TestProjects, JournalReplay)
+{
+    m_Project->save();
+    ASSERT_TRUE(m_Project->waitForSaved());
+
+    m_Project->database()->addScope("foo")->addType("bar");
+    m_Project->autosave();
+    EXPECT_TRUE(m_Project->isAutosaving());
+    m_Project->waitForAutosaved();
+
+    auto name = m_Project->name().toLower().replace(" ", "_");
+    QFile journal(rootPath_ + sep_ + name + "." + PROJECT_JOURNAL_EXTENTION);
+    ASSERT_TRUE(journal.exists());
+
+    // Torn record left after a crash
+    ASSERT_TRUE(journal.open(QIODevice::WriteOnly | QIODevice::Append));
+    journal.write(QByteArray("\0\0\1\0garbage", 11));
+    journal.close();
+
+    setProject(std::make_shared<Projects::Project>("no name here ", "no path here"));
+    m_Project->load(rootPath_ + sep_ + name + "." + PROJECT_FILE_EXTENTION);
+
+    EXPECT_FALSE(m_Project->hasErrors());
+    EXPECT_TRUE(m_Project->isModified())
+        << "Recovered changes are not saved yet.";
+
+    auto scope = m_Project->database()->chainScopeSearch({"foo"});
+    ASSERT_TRUE(!!scope);
+    EXPECT_TRUE(!!scope->type("bar"));
+
+    m_Project->save();
+    EXPECT_TRUE(m_Project->waitForSaved());
+    EXPECT_FALSE(journal.exists())
+        << "Journal should be compacted into the main files.";
+}
+
+TEST_F(TestProjects, JournalTypeRecords)
+{
+    auto scope = m_Project->database()->addScope("foo");
+    auto bar = scope->addType("bar");
+    auto baz = scope->addType("baz");
+    m_Project->save();
+    ASSERT_TRUE(m_Project->waitForSaved());
+
+    // Only changed and removed types of the scope are recorded
+    bar->setName("qux");
+    scope->removeType(baz->id());
+    m_Project->autosave();
+    m_Project->waitForAutosaved();
+
+    auto name = m_Project->name().toLower().replace(" ", "_");
+    setProject(std::make_shared<Projects::Project>("no name here ", "no path here"));
+    m_Project->load(rootPath_ + sep_ + name + "." + PROJECT_FILE_EXTENTION);
+
+    EXPECT_FALSE(m_Project->hasErrors());
+
+    auto loaded = m_Project->database()->chainScopeSearch({"foo"});
+    ASSERT_TRUE(!!loaded);
+    EXPECT_TRUE(!!loaded->type("qux"));
+    EXPECT_FALSE(!!loaded->type("bar"));
+    EXPECT_FALSE(!!loaded->type("baz"));
+    EXPECT_EQ(loaded->types().count(), 1);
+}
+
+TEST_F(TestProjects, SnapshotIsDroppedOnChange)
+{
+    auto scope = m_Project->database()->addScope("foo");
+    auto type = scope->addType<Entity::Class>("bar");
+    m_Project->save();
+    ASSERT_TRUE(m_Project->waitForSaved());
+
+    // Commands mark the project as modified after each change
+    type->setFinalStatus(true);
+    m_Project->setModified(true);
+    m_Project->save();
+    ASSERT_TRUE(m_Project->waitForSaved());
+
+    auto name = m_Project->name().toLower().replace(" ", "_");
+    setProject(std::make_shared<Projects::Project>("no name here ", "no path here"));
+    m_Project->load(rootPath_ + sep_ + name + "." + PROJECT_FILE_EXTENTION);
+    EXPECT_FALSE(m_Project->hasErrors());
+
+    auto loaded = m_Project->database()->chainScopeSearch({"foo"});
+    ASSERT_TRUE(!!loaded);
+    auto loadedType = std::dynamic_pointer_cast<Entity::Class>(loaded->type("bar"));
+    ASSERT_TRUE(!!loadedType);
+    EXPECT_TRUE(loadedType->isFinal());
+}
+
+TEST_F(TestProjects, TreeItemsIndex)
+{
+    auto scope = m_Project->database()->addScope("foo");
+
+    Models::BasicTreeItem root;
+    auto scopeItem = root.makeChild(QVariant::fromValue(scope), Models::TreeItemType::ScopeItem);
+
+    QVector<Models::BasicTreeItem *> typeItems;
+    for (int i = 0; i < 100; ++i)
+        typeItems << scopeItem->makeChild(QVariant::fromValue(scope->addType(QString("bar%1").arg(i))),
+                                          Models::TreeItemType::TypeItem);
+
+    EXPECT_EQ(root.childCount(true), 101);
+    EXPECT_EQ(scopeItem->childCount(), 100);
+    EXPECT_EQ(root.itemById(QVariant::fromValue(scope->id())), scopeItem);
+    EXPECT_EQ(scopeItem->itemById(typeItems[50]->id()), typeItems[50]);
+    EXPECT_EQ(typeItems[50]->row(), 50);
+
+    auto removedId = typeItems[10]->id();
+    EXPECT_TRUE(scopeItem->removeChild(typeItems[10]));
+    EXPECT_EQ(root.childCount(true), 100);
+    EXPECT_EQ(typeItems[50]->row(), 49);
+    EXPECT_EQ(scopeItem->itemById(removedId), nullptr);
+
+    // Renamed project is found after the index is invalidated
+    auto projectItem = root.makeChild(QVariant::fromValue(m_Project),
+                                      Models::TreeItemType::ProjectItem);
+    const auto oldName = projectItem->id();
+    EXPECT_EQ(root.itemById(oldName), projectItem);
+
+    m_Project->setName(m_Project->name() + "_renamed");
+    EXPECT_EQ(root.itemById(oldName), nullptr);
+    root.invalidateIndex();
+    EXPECT_EQ(root.itemById(projectItem->id()), projectItem);
+}
+
+TEST_F(TestProjects, TreeModelBulkLoad)
+{
+    Models::ProjectTreeModel model;
+    model.addProject(m_Project);
+
+    auto projectIndex = model.index(0, 0);
+    const int scopesCount = model.rowCount(projectIndex);
+
+    int inserts = 0, resets = 0;
+    QObject::connect(&model, &QAbstractItemModel::rowsInserted, [&] { ++inserts; });
+    QObject::connect(&model, &QAbstractItemModel::modelReset, [&] { ++resets; });
+
+    {
+        qthelpers::BulkLoadGuard<Models::ProjectTreeModel> bulkLoad(&model);
+        for (int i = 0; i < 10; ++i)
+            m_Project->database()->addScope(QString("foo%1").arg(i));
+    }
+
+    EXPECT_EQ(inserts, 0);
+    EXPECT_EQ(resets, 1);
+    EXPECT_EQ(model.rowCount(model.index(0, 0)), scopesCount + 10);
+
+    // Bulk load of the project database is forwarded to the model
+    {
+        qthelpers::BulkLoadGuard<DB::ProjectDatabase> bulkLoad(m_Project->database().get());
+        EXPECT_TRUE(model.isBulkLoading());
+        for (int i = 0; i < 10; ++i)
+            m_Project->database()->addScope(QString("bar%1").arg(i));
+    }
+
+    EXPECT_FALSE(model.isBulkLoading());
+    EXPECT_EQ(inserts, 0);
+    EXPECT_EQ(resets, 2);
+    EXPECT_EQ(model.rowCount(model.index(0, 0)), scopesCount + 20);
+}
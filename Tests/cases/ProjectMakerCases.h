@@ -22,6 +22,8 @@
 *****************************************************************************/
 #pragma once
 
+#include <QDirIterator>
+
 #include "Tests/TestProjectMaker.h"
 
 #include <Entity/Scope.h>
@@ -165,3 +167,133 @@ TEST_F(ProjectMaker, MakeTemplateClass)
     EXPECT_EQ(tstHeader.toStdString(), genHeader.toStdString())
             << "Generated data for header must be the same with test data";
 }
+
+TEST_F(ProjectMaker, ParallelGeneration)
+{
+    QList<Entity::SharedField> parameters;
+    for (auto &&scopeName : {"first", "second"}) {
+        auto scope = m_ProjectDb->addScope(scopeName);
+        auto nested = scope->addChildScope("nested");
+        for (int i = 0; i < 20; ++i) {
+            auto cl = scope->addType<Entity::Class>(QString("Class%1").arg(i));
+            cl->addField("value", m_GlobalDb->typeByName("int")->id(), "m_", Entity::Private);
+            cl->makeMethod("value")->setReturnTypeId(m_GlobalDb->typeByName("int")->id());
+            parameters << cl->makeMethod("setValue")->addParameter("value", m_GlobalDb->typeByName("int")->id());
+            parameters.last()->setPrefix("p_");
+            nested->addType<Entity::Class>(QString("Nested%1").arg(i));
+        }
+    }
+
+    auto generate = [&](Generator::AbstractProjectGenerator::GeneratorOptions options) {
+        auto generator = std::make_shared<Generator::BasicCppProjectGenerator>(
+                             m_GlobalDb, m_ProjectDb, rootPath_ + sep_ + "out");
+        generator->setProjectName("test_app");
+        generator->setOptions(options);
+        generator->generate();
+        generator->writeToDisk();
+
+        QMap<QString, QString> files;
+        QDirIterator it(rootPath_ + sep_ + "out", QDir::Files, QDirIterator::Subdirectories);
+        while (it.hasNext()) {
+            QFile f(it.next());
+            EXPECT_TRUE(f.open(QIODevice::ReadOnly));
+            files[f.fileName()] = QString::fromUtf8(f.readAll());
+        }
+
+        EXPECT_TRUE(QDir(rootPath_ + sep_ + "out").removeRecursively());
+        return files;
+    };
+
+    using Gen = Generator::AbstractProjectGenerator;
+    auto serial = generate(Gen::NamespacesInSubfolders);
+    auto parallel = generate(Gen::NamespacesInSubfolders | Gen::ParallelGeneration);
+
+    ASSERT_FALSE(serial.isEmpty());
+    EXPECT_EQ(serial, parallel) << "Parallel generation should give the same files.";
+
+    // Generation must not modify the model
+    for (auto &&parameter : parameters)
+        EXPECT_EQ(parameter->prefix(), QString("p_"));
+}
+
+TEST_F(ProjectMaker, IncrementalGeneration)
+{
+    auto scope = m_ProjectDb->addScope("work");
+    auto first = scope->addType<Entity::Class>("First");
+    auto second = scope->addType<Entity::Class>("Second");
+
+    auto generate = [&] {
+        auto generator = std::make_shared<Generator::BasicCppProjectGenerator>(m_GlobalDb, m_ProjectDb,
+                                                                               rootPath_);
+        generator->setProjectName("test_app");
+        generator->addOption(Generator::AbstractProjectGenerator::IncrementalGeneration);
+        generator->generate();
+        generator->writeToDisk();
+        EXPECT_FALSE(generator->anyErrors());
+    };
+
+    auto readFile = [&](const QString &name) {
+        QFile f(rootPath_ + sep_ + name);
+        return f.open(QIODevice::ReadOnly) ? QString::fromUtf8(f.readAll()) : QString();
+    };
+
+    auto markFile = [&](const QString &name) {
+        QFile f(rootPath_ + sep_ + name);
+        ASSERT_TRUE(f.open(QIODevice::Append));
+        f.write("// marker");
+    };
+
+    generate();
+    ASSERT_FALSE(readFile("first.h").isEmpty());
+
+    markFile("first.h");
+    markFile("second.h");
+    second->makeMethod("foo")->setReturnTypeId(m_GlobalDb->typeByName("int")->id());
+    generate();
+
+    EXPECT_TRUE(readFile("first.h").endsWith("// marker"))
+            << "Unchanged type should not be written again.";
+    EXPECT_FALSE(readFile("second.h").endsWith("// marker"))
+            << "Changed type should be generated again.";
+
+    // Dependency is used through an extended type, so renaming it must regenerate the user
+    auto pointerToSecond = m_GlobalScope->addType<Entity::ExtendedType>();
+    pointerToSecond->setTypeId(second->id());
+    pointerToSecond->addPointerStatus();
+    first->addField("second", pointerToSecond->id(), "m_", Entity::Private);
+    generate();
+
+    markFile("first.h");
+    second->setName("Another");
+    generate();
+    EXPECT_FALSE(readFile("first.h").endsWith("// marker"))
+            << "Type should be generated again when its dependency is renamed.";
+    EXPECT_TRUE(readFile("first.h").contains("Another"));
+
+    markFile("first.h");
+    pointerToSecond->setConstStatus(true);
+    generate();
+    EXPECT_FALSE(readFile("first.h").endsWith("// marker"))
+            << "Type should be generated again when modifiers of a used type are changed.";
+
+    // Numbers in the type data are not dependencies, even if they look like IDs
+    auto unrelated = scope->addType<Entity::Class>("Unrelated");
+    second->addField("count", m_GlobalDb->typeByName("int")->id())
+          ->setDefaultValue(unrelated->id().toString());
+    generate();
+
+    markFile("another.h");
+    unrelated->setName("Renamed");
+    generate();
+    EXPECT_TRUE(readFile("another.h").endsWith("// marker"))
+            << "Type should not depend on a type whose ID is only used as a value.";
+
+    scope->removeType(first->id());
+    generate();
+    EXPECT_FALSE(QFile::exists(rootPath_ + sep_ + "first.h"))
+            << "Files of removed type should be deleted.";
+    EXPECT_FALSE(readFile("test_app.pro").contains("first.h"));
+    EXPECT_TRUE(readFile("test_app.pro").contains("another.h"));
+
+    m_GlobalScope->removeType(pointerToSecond->id());
+}
@@ -24,8 +24,13 @@
 
 #include "Tests/TestProjectTranslator.h"
 
+#include <QtTest/QSignalSpy>
+
 #include <templates.cpp>
 
+#include <Translation/codebuilder.h>
+#include <Translation/translationsession.h>
+
 TEST_F(ProjectTranslatorTest, Type)
 {
     QString futureResult("int");
@@ -555,3 +560,106 @@ TEST_F(ProjectTranslatorTest, TemplateClassImplementation)
     Translation::Code code(m_Translator->generateClassMethodsImpl(scopedPointer));
     ASSERT_EQ(futureResult, code.toHeader);
 }
+
+TEST_F(ProjectTranslatorTest, NestedNamespaces)
+{
+    auto inner = m_ProjectDb->addScope("outer")->addChildScope("inner");
+    auto foo = inner->addType("Foo");
+
+    Translation::Code code("int a;\n\nint b;", "void f()\n{\n}");
+    m_Translator->addNamespace(foo, code);
+
+    EXPECT_EQ(code.toHeader.toStdString(),
+              "namespace outer\n{\n\n"
+              "    namespace inner\n    {\n\n"
+              "        int a;\n\n"
+              "        int b;\n\n"
+              "    } // namespace inner\n\n"
+              "} // namespace outer");
+    EXPECT_EQ(code.toSource.toStdString(),
+              "namespace outer\n{\n\n"
+              "    namespace inner\n    {\n\n"
+              "        void f()\n"
+              "        {\n"
+              "        }\n"
+              "    } // namespace inner\n"
+              "} // namespace outer");
+}
+
+TEST(CodeBuilder, IndentsNonEmptyLines)
+{
+    Translation::CodeBuilder builder;
+    builder << "class Foo\n{\n";
+    builder.indent() << "int a;\n\nint b;\n";
+    builder.unindent() << "};";
+
+    EXPECT_EQ(builder.build().toStdString(), "class Foo\n{\n    int a;\n\n    int b;\n};");
+    EXPECT_EQ(builder.size(), builder.build().size());
+
+    builder.writeRaw("\n\n");
+    EXPECT_TRUE(builder.build().endsWith("};\n\n"));
+}
+
+TEST_F(ProjectTranslatorTest, TranslationSession)
+{
+    auto session = std::make_shared<Translation::TranslationSession>();
+    m_Translator->setSession(session);
+
+    auto scope = m_ProjectScope->addChildScope("foo_scope");
+    auto foo = scope->addType("Foo");
+    auto field = std::make_shared<Entity::Field>("foo", foo->id());
+
+    ASSERT_EQ(m_Translator->translate(field).toHeader.toStdString(), "foo_scope::Foo foo");
+    auto misses = session->misses();
+    EXPECT_GT(misses, 0u);
+
+    ASSERT_EQ(m_Translator->translate(field).toHeader.toStdString(), "foo_scope::Foo foo");
+    EXPECT_EQ(session->misses(), misses);
+    EXPECT_GT(session->hits(), 0u);
+
+    // Cached name is used until the session is invalidated
+    foo->setName("Bar");
+    EXPECT_EQ(m_Translator->translate(field).toHeader.toStdString(), "foo_scope::Foo foo");
+
+    session->invalidate(foo->id());
+    EXPECT_EQ(m_Translator->translate(field).toHeader.toStdString(), "foo_scope::Bar foo");
+    EXPECT_GT(session->misses(), misses);
+
+    m_Translator->setSession(nullptr);
+}
+
+TEST_F(ProjectTranslatorTest, FieldTypesLookupOrder)
+{
+    auto fooClass = m_ProjectScope->addType<Entity::Class>("Foo");
+    fooClass->addField("a", m_int->id())->setSection(Entity::Public);
+
+    // Types of fields are searched in the global database first
+    auto shadow = m_ProjectScope->addType("Shadow");
+    shadow->setId(m_int->id());
+    ASSERT_EQ(m_ProjectDb->typeByID(m_int->id()), shadow);
+
+    auto code = m_Translator->translate(fooClass);
+    EXPECT_TRUE(code.toHeader.contains("int a;")) << code.toHeader.toStdString();
+    EXPECT_FALSE(code.toHeader.contains("Shadow")) << code.toHeader.toStdString();
+
+    m_ProjectScope->removeType(shadow->id());
+    m_ProjectScope->removeType(fooClass->id());
+}
+
+TEST_F(ProjectTranslatorTest, MethodParametersAreNotModified)
+{
+    auto method = std::make_shared<Entity::ClassMethod>("setValue");
+    method->setReturnTypeId(m_void->id());
+    auto parameter = method->addParameter("value", m_int->id());
+    parameter->setPrefix("m_");
+    parameter->setSuffix("_");
+
+    QSignalSpy spy(parameter.get(), &Common::BasicElement::changed);
+    auto code = m_Translator->translate(method);
+    EXPECT_EQ(code.toHeader, QString("void setValue(int value)"));
+
+    // Translation is read-only over the model
+    EXPECT_EQ(parameter->prefix(), QString("m_"));
+    EXPECT_EQ(parameter->suffix(), QString("_"));
+    EXPECT_EQ(spy.count(), 0);
+}
@@ -5,7 +5,7 @@ CONFIG -= app_bundle
 
 QMAKE_CXXFLAGS *= -pedantic -Wextra -Wall
 
-QT += widgets testlib
+QT += widgets concurrent testlib
 
 LIBS += -lgtest -lpthread
 
@@ -31,11 +31,13 @@ HEADERS += \
     $$PWD/../Application/settings.h \
     $$PWD/../Project/project.h \
     $$PWD/../Project/ProjectFactory.hpp \
+    $$PWD/../Project/ProjectJournal.h \
     $$PWD/../Entity/property.h \
     $$PWD/../Entity/class.h \
     $$PWD/../Entity/scope.h \
     $$PWD/../Entity/isectional.h \
     $$PWD/../Entity/Components/icomponents.h \
+    $$PWD/../Entity/Components/declarationsimporter.h \
     $$PWD/../Entity/GraphicEntityData.h \
     $$PWD/../Entity/EntityFactory.h \
     $$PWD/../Entity/Template.h \
@@ -50,6 +52,7 @@ HEADERS += \
     $$PWD/../GUI/graphics/GraphicsRelation.h \
     $$PWD/../GUI/graphics/Entity.h \
     $$PWD/../GUI/graphics/Scene.h \
+    $$PWD/../GUI/graphics/SpatialGrid.h \
     $$PWD/../GUI/graphics/HeaderEditorEventFilter.h \
     $$PWD/../Relationship/Relation.h \
     $$PWD/../Relationship/RelationFactory.h \
@@ -58,11 +61,16 @@ HEADERS += \
     $$PWD/../Commands/basecommand.h \
     $$PWD/../Commands/CreateEntity.h \
     $$PWD/../Commands/CreateScope.h \
+    $$PWD/../Commands/ImportDeclarations.h \
     $$PWD/../Commands/MakeProjectCurrent.h \
     $$PWD/../Commands/MoveGraphicObject.h \
+    $$PWD/../Commands/ResizeGraphicEntity.h \
+    $$PWD/../Commands/UndoMemoryLimiter.h \
     $$PWD/../Commands/AddRelation.h \
     $$PWD/../Commands/RemoveProject.h \
     $$PWD/../Commands/RenameEntity.h \
+    $$PWD/../Commands/MementoCmd.hpp \
+    $$PWD/../Commands/EditComponent.h \
     $$PWD/../Commands/OpenProject.h \
     $$PWD/../Commands/CommandFactory.hpp \
     $$PWD/../Entity/ITextRepresentable.hpp \
@@ -88,9 +96,13 @@ HEADERS += \
     TestProjectBase.h \
     $$PWD/../DB/ProjectDatabase.h \
     $$PWD/../DB/Database.h \
+    $$PWD/../DB/LazyLoader.h \
+    $$PWD/../DB/BinaryFormat.h \
     $$PWD/../Common/BasicElement.h \
     $$PWD/../Common/ID.h \
     $$PWD/../Common/Memento.hpp \
+    $$PWD/../Common/MementoDelta.hpp \
+    $$PWD/../Common/StringPool.h \
     $$PWD/../DB/DBTypes.hpp \
     $$PWD/../Project/ProjectDB.hpp \
     cases/TypeMakerTestCases.h \
@@ -136,10 +148,14 @@ SOURCES += main.cpp \
            $$PWD/../Common/IOriginator.cpp \
            $$PWD/../Common/id.cpp \
            $$PWD/../Common/Memento.cpp \
+           $$PWD/../Common/MementoDelta.cpp \
+           $$PWD/../Common/StringPool.cpp \
            $$PWD/../Entity/isectional.cpp \
            $$PWD/../Utility/helpfunctions.cpp \
            $$PWD/../DB/database.cpp \
            $$PWD/../DB/ProjectDatabase.cpp \
+           $$PWD/../DB/LazyLoader.cpp \
+           $$PWD/../DB/BinaryFormat.cpp \
            $$PWD/../Relationship/Relation.cpp \
            $$PWD/../Relationship/node.cpp \
            $$PWD/../Relationship/generalization.cpp \
@@ -151,6 +167,7 @@ SOURCES += main.cpp \
            $$PWD/../GUI/graphics/GraphicsRelation.cpp \
            $$PWD/../GUI/graphics/Entity.cpp \
            $$PWD/../GUI/graphics/Scene.cpp \
+           $$PWD/../GUI/graphics/SpatialGrid.cpp \
            $$PWD/../GUI/graphics/HeaderEditorEventFilter.cpp \
            $$PWD/../Entity/templateclassmethod.cpp \
            $$PWD/../Entity/scope.cpp \
@@ -162,12 +179,17 @@ SOURCES += main.cpp \
            $$PWD/../Generator/virtualfilesystemabstractitem.cpp \
            $$PWD/../Generator/abstractprojectgenerator.cpp \
            $$PWD/../Generator/basiccppprojectgenerator.cpp \
+           $$PWD/../Generator/generationmanifest.cpp \
            $$PWD/../Project/project.cpp \
            $$PWD/../Project/ProjectDB.cpp \
            $$PWD/../Project/ProjectFactory.cpp \
+           $$PWD/../Project/ProjectJournal.cpp \
            $$PWD/../Translation/code.cpp \
+           $$PWD/../Translation/codebuilder.cpp \
            $$PWD/../Entity/Components/componentsignatureparser.cpp \
+           $$PWD/../Entity/Components/declarationsimporter.cpp \
            $$PWD/../Translation/signaturemaker.cpp \
+           $$PWD/../Translation/translationsession.cpp \
            $$PWD/../Models/ApplicationModel.cpp \
            $$PWD/../Models/projecttreemodel.cpp \
            $$PWD/../Models/basictreeitem.cpp \
@@ -177,11 +199,16 @@ SOURCES += main.cpp \
            $$PWD/../Commands/basecommand.cpp \
            $$PWD/../Commands/CreateEntity.cpp \
            $$PWD/../Commands/CreateScope.cpp \
+           $$PWD/../Commands/ImportDeclarations.cpp \
            $$PWD/../Commands/MakeProjectCurrent.cpp \
            $$PWD/../Commands/MoveGraphicObject.cpp \
+           $$PWD/../Commands/ResizeGraphicEntity.cpp \
+           $$PWD/../Commands/UndoMemoryLimiter.cpp \
            $$PWD/../Commands/AddRelation.cpp \
            $$PWD/../Commands/RemoveProject.cpp \
            $$PWD/../Commands/RenameEntity.cpp \
+           $$PWD/../Commands/MementoCmd.cpp \
+           $$PWD/../Commands/EditComponent.cpp \
            $$PWD/../Commands/OpenProject.cpp \
            $$PWD/../Commands/CommandFactory.cpp \
            $$PWD/../Entity/Converters/BaseTextConversionStrategy.cpp \
@@ -0,0 +1,50 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include <QCoreApplication>
+#include <QTextStream>
+
+#include <DB/BinaryFormat.h>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("uml-tool-dbconvert");
+
+    QTextStream err(stderr);
+
+    const QStringList args = QCoreApplication::arguments();
+    if (args.size() != 3) {
+        err << "Usage: uml-tool-dbconvert <source> <destination>\n"
+            << "Converts JSON database to binary and vice versa.\n";
+        return 2;
+    }
+
+    ErrorList errors;
+    if (!DB::Binary::convert(args[1], args[2], errors)) {
+        for (auto &&e : errors)
+            err << e << "\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <DB/Database.h>
+#include <DB/ProjectDatabase.h>
+
+#include <Entity/EntityFactory.h>
+
+#include <Generator/basiccppprojectgenerator.h>
+
+#include <Project/Project.h>
+#include <Project/ProjectFactory.hpp>
+
+#include <Relationship/RelationFactory.h>
+
+namespace {
+
+    using Options = Generator::AbstractProjectGenerator::GeneratorOptions;
+
+    /// Single project processing state and per-phase timings, ms
+    struct Job
+    {
+        QString path;
+        Projects::SharedProject project;
+        ErrorList errors;
+
+        qint64 load = 0;
+        qint64 translate = 0;
+        qint64 write = 0;
+    };
+
+    DB::SharedDatabase loadGlobalDatabase(const QString &path, ErrorList &errors)
+    {
+        const QFileInfo info(path);
+        auto db = std::make_shared<DB::Database>(info.completeBaseName(), info.absolutePath());
+
+        // Projects are generated concurrently, so nothing should be loaded on demand
+        db->setLoadMode(DB::Database::LoadMode::Eager);
+        db->load(errors);
+
+        return db;
+    }
+
+    // Entities are created by the process-wide factories bound to the current project,
+    // so projects are loaded one by one
+    void load(Job &job)
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        job.project = Projects::ProjectFactory::instance().makeProject();
+        job.project->database()->setLoadMode(DB::Database::LoadMode::Eager);
+        job.project->load(QFileInfo(job.path).absoluteFilePath());
+
+        if (job.project->hasErrors())
+            job.errors << job.project->lastErrors();
+
+        job.load = timer.elapsed();
+    }
+
+    void generate(Job &job, const DB::SharedDatabase &globalDb, const QString &outputDir,
+                  Options options)
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        const QString name = job.project->name();
+        Generator::BasicCppProjectGenerator generator(globalDb, job.project->database(),
+                                                      QDir(outputDir).filePath(name));
+        generator.setProjectName(name);
+        generator.setOptions(options);
+
+        generator.generate();
+        job.translate = timer.restart();
+
+        generator.writeToDisk();
+        job.write = timer.elapsed();
+
+        if (generator.anyErrors())
+            job.errors << *generator.errors();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("uml-tool-gen");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Generates C++ code for Q-UML projects without GUI.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("projects", "Project files (*.qut).", "<project>...");
+
+    const QString defaultGlobalDb =
+        QDir(QCoreApplication::applicationDirPath()).filePath("global.qutdb");
+    QCommandLineOption globalDbOption({"g", "global-db"}, "Global database file.", "file",
+                                      defaultGlobalDb);
+    QCommandLineOption outputOption({"o", "output"},
+                                    "Output directory, each project is placed in a subdirectory.",
+                                    "dir", QDir::currentPath());
+    QCommandLineOption jobsOption({"j", "jobs"}, "Number of projects processed concurrently.", "n",
+                                  QString::number(QThread::idealThreadCount()));
+    QCommandLineOption subfoldersOption("namespaces-in-subfolders", "Place namespaces in subfolders.");
+    QCommandLineOption guardOption("include-guard", "Use include guards instead of #pragma once.");
+    QCommandLineOption parallelOption("parallel", "Translate types of each project concurrently.");
+    QCommandLineOption incrementalOption("incremental", "Skip types which are not changed.");
+    parser.addOptions({globalDbOption, outputOption, jobsOption, subfoldersOption, guardOption,
+                       parallelOption, incrementalOption});
+    parser.process(a);
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    const QStringList paths = parser.positionalArguments();
+    if (paths.isEmpty())
+        parser.showHelp(2);
+
+    Options options(Generator::AbstractProjectGenerator::NoOptions);
+    if (parser.isSet(subfoldersOption))
+        options |= Generator::AbstractProjectGenerator::NamespacesInSubfolders;
+    if (parser.isSet(guardOption))
+        options |= Generator::AbstractProjectGenerator::DefineIcludeGuard;
+    if (parser.isSet(parallelOption))
+        options |= Generator::AbstractProjectGenerator::ParallelGeneration;
+    if (parser.isSet(incrementalOption))
+        options |= Generator::AbstractProjectGenerator::IncrementalGeneration;
+
+    QElapsedTimer total;
+    total.start();
+
+    ErrorList errors;
+    auto globalDb = loadGlobalDatabase(parser.value(globalDbOption), errors);
+    if (!errors.isEmpty()) {
+        for (auto &&e : errors)
+            err << e << "\n";
+        return 1;
+    }
+
+    Projects::ProjectFactory::instance().initialise(globalDb);
+    const_cast<Entity::EntityFactory &>(Entity::EntityFactory::instance()).setGlobalDatabase(globalDb);
+    const_cast<Relationship::RelationFactory &>(
+        Relationship::RelationFactory::instance()).setGlobalDatabase(globalDb);
+
+    QVector<Job> jobs;
+    jobs.reserve(paths.size());
+    for (auto &&path : paths) {
+        jobs << Job{path, nullptr, {}};
+        load(jobs.last());
+    }
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMax(1, parser.value(jobsOption).toInt()));
+
+    const QString outputDir = parser.value(outputOption);
+    QVector<QFuture<void>> futures;
+    for (auto &&job : jobs)
+        if (job.errors.isEmpty())
+            futures << QtConcurrent::run(&pool, [&job, &globalDb, &outputDir, options] {
+                generate(job, globalDb, outputDir, options);
+            });
+
+    for (auto &&f : futures)
+        f.waitForFinished();
+
+    int failed = 0;
+    for (auto &&job : jobs) {
+        out << job.path << ": load " << job.load << " ms, translate " << job.translate
+            << " ms, write " << job.write << " ms\n";
+
+        if (!job.errors.isEmpty()) {
+            ++failed;
+            for (auto &&e : job.errors)
+                err << job.path << ": " << e << "\n";
+        }
+    }
+
+    out << jobs.size() << " project(s), " << failed << " failed, total " << total.elapsed()
+        << " ms\n";
+
+    return failed ? 1 : 0;
+}
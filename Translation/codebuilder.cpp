@@ -0,0 +1,176 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+
+#include "codebuilder.h"
+
+namespace Translation {
+
+    /**
+     * @brief CodeBuilder::CodeBuilder
+     * @param indentUnit
+     */
+    CodeBuilder::CodeBuilder(const QString &indentUnit)
+        : m_IndentUnit(indentUnit)
+        , m_IndentLevel(0)
+        , m_LineStart(true)
+        , m_Size(0)
+    {}
+
+    /**
+     * @brief CodeBuilder::indent
+     * @param count
+     * @return
+     */
+    CodeBuilder &CodeBuilder::indent(int count)
+    {
+        m_IndentLevel += count;
+        return *this;
+    }
+
+    /**
+     * @brief CodeBuilder::unindent
+     * @param count
+     * @return
+     */
+    CodeBuilder &CodeBuilder::unindent(int count)
+    {
+        m_IndentLevel = qMax(0, m_IndentLevel - count);
+        return *this;
+    }
+
+    /**
+     * @brief CodeBuilder::indentLevel
+     * @return
+     */
+    int CodeBuilder::indentLevel() const
+    {
+        return m_IndentLevel;
+    }
+
+    /**
+     * @brief CodeBuilder::write
+     * @param text
+     * @return
+     */
+    CodeBuilder &CodeBuilder::write(const QString &text)
+    {
+        int begin = 0;
+        const int size = text.size();
+        while (begin < size) {
+            int end = text.indexOf(QChar('\n'), begin);
+            if (end == -1)
+                end = size;
+
+            // Empty lines are not indented
+            if (m_LineStart && end > begin)
+                for (int i = 0; i < m_IndentLevel; ++i)
+                    addSegment(m_IndentUnit, 0, m_IndentUnit.size());
+
+            if (end < size) {
+                addSegment(text, begin, end - begin + 1);
+                m_LineStart = true;
+            } else {
+                addSegment(text, begin, end - begin);
+                m_LineStart = false;
+            }
+
+            begin = end + 1;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief CodeBuilder::writeRaw
+     * @param text
+     * @return
+     */
+    CodeBuilder &CodeBuilder::writeRaw(const QString &text)
+    {
+        if (!text.isEmpty()) {
+            addSegment(text, 0, text.size());
+            m_LineStart = text.endsWith(QChar('\n'));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief CodeBuilder::operator <<
+     * @param text
+     * @return
+     */
+    CodeBuilder &CodeBuilder::operator <<(const QString &text)
+    {
+        return write(text);
+    }
+
+    /**
+     * @brief CodeBuilder::isEmpty
+     * @return
+     */
+    bool CodeBuilder::isEmpty() const
+    {
+        return m_Size == 0;
+    }
+
+    /**
+     * @brief CodeBuilder::size
+     * @return
+     */
+    int CodeBuilder::size() const
+    {
+        return m_Size;
+    }
+
+    /**
+     * @brief CodeBuilder::build
+     * @return
+     */
+    QString CodeBuilder::build() const
+    {
+        QString result;
+        result.reserve(m_Size);
+
+        for (auto &&s : m_Segments)
+            result.append(s.source.constData() + s.position, s.length);
+
+        return result;
+    }
+
+    /**
+     * @brief CodeBuilder::addSegment
+     * @param source
+     * @param position
+     * @param length
+     */
+    void CodeBuilder::addSegment(const QString &source, int position, int length)
+    {
+        if (length <= 0)
+            return;
+
+        m_Segments << Segment{source, position, length};
+        m_Size += length;
+    }
+
+} // namespace translation
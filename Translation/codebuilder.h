@@ -0,0 +1,73 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+
+#pragma once
+
+#include <QString>
+#include <QVector>
+
+namespace Translation {
+
+    /**
+     * @brief The CodeBuilder class. Collects pieces of code without copying them and
+     * makes the final string with a single allocation.
+     * Text written with write() gets current indentation on each non-empty line.
+     */
+    class CodeBuilder
+    {
+    public:
+        explicit CodeBuilder(const QString &indentUnit = QString(4, QChar::Space));
+
+        CodeBuilder &indent(int count = 1);
+        CodeBuilder &unindent(int count = 1);
+        int indentLevel() const;
+
+        CodeBuilder &write(const QString &text);
+        CodeBuilder &writeRaw(const QString &text);
+
+        CodeBuilder &operator <<(const QString &text);
+
+        bool isEmpty() const;
+        int size() const;
+
+        QString build() const;
+
+    private:
+        struct Segment
+        {
+            QString source; // implicitly shared, not copied
+            int position;
+            int length;
+        };
+
+        void addSegment(const QString &source, int position, int length);
+
+        QString m_IndentUnit;
+        int m_IndentLevel;
+        bool m_LineStart;
+
+        QVector<Segment> m_Segments;
+        int m_Size;
+    };
+
+} // namespace translation
@@ -22,7 +22,6 @@
 *****************************************************************************/
 #include "projecttranslator.h"
 
-#include <QRegularExpression>
 #include <QDebug>
 
 #include <DB/Database.h>
@@ -43,24 +42,39 @@
 #include "templates.cpp"
 #include "Constants.h"
 #include "code.h"
+#include "codebuilder.h"
 #include "signaturemaker.h"
+#include "translationsession.h"
 
 namespace {
 
-    void addNamesapceHelper(QString &code, const QStringList &scopesNames, const QString &indent,
-                            QString scopeTemplate)
+    /// Wraps code into all namespaces at once, each nesting level adds one indent to non-empty lines.
+    /// Scopes names are ordered from the innermost one
+    QString addNamespaces(const QString &code, const QStringList &scopesNames, const QString &indent,
+                          const QString &scopeTemplate)
     {
-        if (!code.isEmpty()) {
-            if (!indent.isEmpty()) {
-                if (!code.startsWith("\n"))
-                    code.prepend(indent);
-                code.replace(QRegularExpression("(\n)(.)"), "\\1" + indent + "\\2");
-            }
+        if (code.isEmpty())
+            return code;
+
+        const QString codeMark("%code%");
+        const int codePos = scopeTemplate.indexOf(codeMark);
+        const QString opening(scopeTemplate.left(codePos));
+        const QString closing(scopeTemplate.mid(codePos + codeMark.size()));
+
+        Translation::CodeBuilder builder(indent);
+        for (int i = scopesNames.size() - 1; i >= 0; --i) {
+            builder << QString(opening).replace("%name%", scopesNames[i]);
+            builder.indent();
+        }
+
+        builder << code;
 
-            code = scopeTemplate.replace("%name%", scopesNames.front())
-                                .replace("%code%", code);
-            code.append(" // namespace " + scopesNames.front());
+        for (auto &&name : scopesNames) {
+            builder.unindent();
+            builder << closing << " // namespace " + name;
         }
+
+        return builder.build();
     }
 
     template <class T, class Map, class Self, class Func>
@@ -92,6 +106,43 @@ namespace Translation {
                                          const DB::SharedProjectDatabase &projectDb)
         : m_GlobalDatabase(globalDb)
         , m_ProjectDatabase(projectDb)
+    {
+        makeCallbacks();
+    }
+
+    /**
+     * @brief ProjectTranslator::ProjectTranslator
+     * @param src
+     */
+    ProjectTranslator::ProjectTranslator(const ProjectTranslator &src)
+        : m_GlobalDatabase(src.m_GlobalDatabase)
+        , m_ProjectDatabase(src.m_ProjectDatabase)
+        , m_Session(src.m_Session)
+    {
+        // Callbacks are bound to the object, so they cannot be copied
+        makeCallbacks();
+    }
+
+    /**
+     * @brief ProjectTranslator::operator =
+     * @param rhs
+     * @return
+     */
+    ProjectTranslator &ProjectTranslator::operator =(const ProjectTranslator &rhs)
+    {
+        if (this != &rhs) {
+            m_GlobalDatabase = rhs.m_GlobalDatabase;
+            m_ProjectDatabase = rhs.m_ProjectDatabase;
+            m_Session = rhs.m_Session;
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief ProjectTranslator::makeCallbacks
+     */
+    void ProjectTranslator::makeCallbacks()
     {
         auto &t = m_translators;
         addTranslator<Entity::Type>               (t, this, &ProjectTranslator::translateType    );
@@ -114,6 +165,59 @@ namespace Translation {
         Q_ASSERT_X(m_ProjectDatabase, "ProjectTranslator", "project database not found");
     }
 
+    /**
+     * @brief ProjectTranslator::findType
+     * @param id
+     * @param localeDatabase
+     * @param classDatabase
+     * @param order
+     * @return
+     */
+    Entity::SharedType ProjectTranslator::findType(const Common::ID &id,
+                                                   const DB::SharedDatabase &localeDatabase,
+                                                   const DB::SharedDatabase &classDatabase,
+                                                   LookupOrder order) const
+    {
+        // Locale databases are different for each entity, only shared databases are cached
+        for (auto &&db : {localeDatabase, classDatabase})
+            if (db)
+                if (auto type = db->typeByID(id))
+                    return type;
+
+        // Types of fields, parameters and template parameters are searched in the global
+        // database first. On a miss the cached result of the project first lookup is the same
+        if (order == LookupOrder::GlobalFirst && m_GlobalDatabase)
+            if (auto type = m_GlobalDatabase->typeByID(id))
+                return type;
+
+        if (!m_Session)
+            return Util::findType(id, m_ProjectDatabase, m_GlobalDatabase);
+
+        return m_Session->type(id, [&]{ return Util::findType(id, m_ProjectDatabase, m_GlobalDatabase); });
+    }
+
+    /**
+     * @brief ProjectTranslator::findScope
+     * @param id
+     * @param localeDatabase
+     * @param classDatabase
+     * @return
+     */
+    Entity::SharedScope ProjectTranslator::findScope(const Common::ID &id,
+                                                     const DB::SharedDatabase &localeDatabase,
+                                                     const DB::SharedDatabase &classDatabase) const
+    {
+        for (auto &&db : {localeDatabase, classDatabase})
+            if (db)
+                if (auto scope = db->scope(id, true /*searchInDepth*/))
+                    return scope;
+
+        if (!m_Session)
+            return Util::findScope(id, m_ProjectDatabase, m_GlobalDatabase);
+
+        return m_Session->scope(id, [&]{ return Util::findScope(id, m_ProjectDatabase, m_GlobalDatabase); });
+    }
+
     /**
      * @brief ProjectTranslator::generateCodeForExtTypeOrType
      * @param id
@@ -128,14 +232,22 @@ namespace Translation {
                                                             const DB::SharedDatabase &classDatabase) const
     {
         checkDb();
-        auto t = Util::findType(id, localeDatabase, classDatabase, m_ProjectDatabase, m_GlobalDatabase);
-        if (!t)
-            return "";
-
-        return t->hashType() == Entity::ExtendedType::staticHashType()
-                   ? translateExtType(std::dynamic_pointer_cast<Entity::ExtendedType>(t),
-                                      options, localeDatabase, classDatabase).toHeader
-                   : translateType(t, options, localeDatabase, classDatabase).toHeader;
+        auto render = [&]() -> QString {
+            auto t = findType(id, localeDatabase, classDatabase);
+            if (!t)
+                return "";
+
+            return t->hashType() == Entity::ExtendedType::staticHashType()
+                       ? translateExtType(std::dynamic_pointer_cast<Entity::ExtendedType>(t),
+                                          options, localeDatabase, classDatabase).toHeader
+                       : translateType(t, options, localeDatabase, classDatabase).toHeader;
+        };
+
+        // Name depends on the locale databases if any, so only names from shared databases are cached
+        if (m_Session && !localeDatabase && !classDatabase)
+            return m_Session->typeName(id, options, render);
+
+        return render();
     }
 
     /**
@@ -147,7 +259,7 @@ namespace Translation {
      */
     void ProjectTranslator::generateClassSection(const Entity::SharedClass &_class,
                                                  const DB::SharedDatabase &localeDatabase,
-                                                 Entity::Section section, QString &out) const
+                                                 Entity::Section section, CodeBuilder &out) const
     {
         // Extract all kinds off methods (include optional methods)
         Entity::MethodsList methods;
@@ -171,7 +283,7 @@ namespace Translation {
             return;
 
         // Add empty string above section
-        out.append("\n");
+        out.writeRaw("\n");
 
         // Check if we need to add section name
         bool needSection = _class->kind() == Entity::ClassType ||
@@ -185,7 +297,7 @@ namespace Translation {
         // Generate fields
         if (!fields.isEmpty()) {
             if (needSection)
-                out.append(INDENT + Util::sectionToString(section) + ":\n");
+                out.writeRaw(INDENT + Util::sectionToString(section) + ":\n");
 
             generateFileds(fields, _class, localeDatabase, needSection ? DOUBLE_INDENT : INDENT, out);
         }
@@ -201,15 +313,13 @@ namespace Translation {
     void ProjectTranslator::generateMethods(const Entity::MethodsList &methods,
                                             const DB::SharedDatabase &localeDatabase,
                                             const QString &indent,
-                                            QString &out) const
+                                            CodeBuilder &out) const
     {
-        QStringList methodsList;
-        for(auto &&m : methods)
-            methodsList << translate(m, WithNamespace, localeDatabase).toHeader.prepend(indent);
-
-        out.append(methodsList.join(";\n"));
-        if (!methodsList.isEmpty())
-            out.append(";\n");
+        for (auto &&m : methods) {
+            out.writeRaw(indent);
+            out.writeRaw(translate(m, WithNamespace, localeDatabase).toHeader);
+            out.writeRaw(";\n");
+        }
     }
 
     /**
@@ -223,26 +333,21 @@ namespace Translation {
     void ProjectTranslator::generateFileds(const Entity::FieldsList &fields,
                                            const Entity::SharedClass &_class,
                                            const DB::SharedDatabase &localeDatabase,
-                                           const QString &indent, QString &out) const
+                                           const QString &indent, CodeBuilder &out) const
     {
-        QStringList fieldsList;
         for (auto &&field : fields) {
-            auto t = Util::findType(field->typeId(), localeDatabase,
-                                       m_GlobalDatabase, m_ProjectDatabase);
+            auto t = findType(field->typeId(), localeDatabase, nullptr, LookupOrder::GlobalFirst);
             if (!t) {
                 qDebug() << "Failed to find field with type:" << QString::number(field->typeId().value());
                 break;
             }
 
-            fieldsList << translate(field,
-                                    t->scopeId() == _class->scopeId() ? NoOptions : WithNamespace,
-                                    localeDatabase)
-                          .toHeader.prepend(indent);
+            out.writeRaw(indent);
+            out.writeRaw(translate(field,
+                                   t->scopeId() == _class->scopeId() ? NoOptions : WithNamespace,
+                                   localeDatabase).toHeader);
+            out.writeRaw(";\n");
         }
-        out.append(fieldsList.join(";\n"));
-
-        if (!fieldsList.isEmpty())
-            out.append(";\n");
     }
 
     /**
@@ -308,11 +413,11 @@ namespace Translation {
                                                    bool needSection,
                                                    Entity::Section section,
                                                    const QString& marker,
-                                                   QString &out) const
+                                                   CodeBuilder &out) const
     {
         if (!methods.isEmpty()) {
             if (needSection)
-                out.append(INDENT + Util::sectionToString(section) + marker);
+                out.writeRaw(INDENT + Util::sectionToString(section) + marker);
 
             generateMethods(methods, localeDatabase, needSection ? DOUBLE_INDENT : INDENT, out);
         }
@@ -347,7 +452,7 @@ namespace Translation {
         QString typeName("");
         auto typeId(_enum->enumTypeId());
         if (typeId.isValid()) {
-            auto t = Util::findType(typeId, m_GlobalDatabase, m_ProjectDatabase);
+            auto t = findType(typeId, nullptr, nullptr, LookupOrder::GlobalFirst);
             if (t)  typeName.append(" : ").append(t->name());
         }
         result.replace("%type%", typeName);
@@ -424,12 +529,9 @@ namespace Translation {
         QString parameters("");
         QStringList parametersList;
         for (auto &&p : method->parameters()) {
-            p->removePrefix(); // TODO check why!
-            p->removeSuffix(); // TODO check why!
-
             TranslatorOptions newOptions((options & NoDefaultName) ? NoDefaultName : NoOptions);
-            auto t = Util::findType(p->typeId(), localeDatabase,
-                                       m_GlobalDatabase, m_ProjectDatabase);
+            newOptions |= NoAffixes;
+            auto t = findType(p->typeId(), localeDatabase, nullptr, LookupOrder::GlobalFirst);
             if (!t || method->scopeId() != t->scopeId() || !method->scopeId().isValid())
                newOptions |= WithNamespace;
 
@@ -552,7 +654,7 @@ namespace Translation {
             QStringList parentsList;
             Entity::SharedType t(nullptr);
             for (auto &&p : _class->parents()) {
-                t = Util::findType(p.first, templateDb, m_GlobalDatabase, m_ProjectDatabase);
+                t = findType(p.first, templateDb, nullptr, LookupOrder::GlobalFirst);
                 QString parentName(Util::sectionToString(p.second) + QChar::Space);
 
                 QString typeName("unknown type");
@@ -576,11 +678,12 @@ namespace Translation {
         toHeader.replace("%parents%", parents);
 
         // Add sections
-        QString section;
-        generateClassSection(_class, templateDb, Entity::Public, section);
-        generateClassSection(_class, templateDb, Entity::None, section); // For signals
-        generateClassSection(_class, templateDb, Entity::Protected, section);
-        generateClassSection(_class, templateDb, Entity::Private, section);
+        CodeBuilder sections;
+        generateClassSection(_class, templateDb, Entity::Public, sections);
+        generateClassSection(_class, templateDb, Entity::None, sections); // For signals
+        generateClassSection(_class, templateDb, Entity::Protected, sections);
+        generateClassSection(_class, templateDb, Entity::Private, sections);
+        QString section(sections.build());
         if (!prop.isEmpty() && !section.isEmpty())
             section.prepend("\n");
         toHeader.replace("%section%", section);
@@ -676,23 +779,19 @@ namespace Translation {
      * @param code
      * @param indentCount
      */
-    void ProjectTranslator::addNamespace(const Entity::SharedType &type, Code &code, uint indentCount)
+    void ProjectTranslator::addNamespace(const Entity::SharedType &type, Code &code, uint indentCount) const
     {
         if (!type || !m_ProjectDatabase)
             return;
 
-        QString newIndent;
-        while (indentCount != 0) {
-            newIndent.append(INDENT);
-            --indentCount;
-        }
+        const QString newIndent(INDENT.repeated(int(indentCount)));
 
-        QStringList scopesNames(Util::scopesNamesList(type,m_ProjectDatabase));
-        while (!scopesNames.isEmpty()) {
-            addNamesapceHelper(code.toHeader, scopesNames, newIndent, SCOPE_TEMPLATE_HEADER);
-            addNamesapceHelper(code.toSource, scopesNames, newIndent, SCOPE_TEMPLATE_SOURCE);
-            scopesNames.pop_front();
-        }
+        const QStringList scopesNames(Util::scopesNamesList(type, m_ProjectDatabase));
+        if (scopesNames.isEmpty())
+            return;
+
+        code.toHeader = addNamespaces(code.toHeader, scopesNames, newIndent, SCOPE_TEMPLATE_HEADER);
+        code.toSource = addNamespaces(code.toSource, scopesNames, newIndent, SCOPE_TEMPLATE_SOURCE);
     }
 
     /**
@@ -717,9 +816,7 @@ namespace Translation {
         result.replace("%const%", extType->isConst() ? "const " : "");
 
         if (extType->typeId().isValid()) {
-            auto t = Util::findType(extType->typeId(), localeDatabase, classDatabase,
-                                       m_ProjectDatabase,
-                                       m_GlobalDatabase);
+            auto t = findType(extType->typeId(), localeDatabase, classDatabase);
             result.replace("%name%", t ?
                 generateCodeForExtTypeOrType(t->id(), options, localeDatabase, classDatabase) : "");
         } else
@@ -741,8 +838,7 @@ namespace Translation {
             QStringList names;
             Entity::SharedType t = nullptr;
             for (auto &&id : extType->templateParameters()) {
-                t = Util::findType(id, localeDatabase, classDatabase, m_ProjectDatabase,
-                                      m_GlobalDatabase);
+                t = findType(id, localeDatabase, classDatabase);
                 if (t)
                     names << t->name();
             }
@@ -789,7 +885,7 @@ namespace Translation {
             type.append(QChar::Space);
         result.replace("%type%", type);
 
-        result.replace("%name%", field->fullName());
+        result.replace("%name%", options & NoAffixes ? field->name() : field->fullName());
 
         if (!field->defaultValue().isEmpty() && !(options & NoDefaultName))
             result.append( " = " + field->defaultValue() );
@@ -815,6 +911,24 @@ namespace Translation {
         m_ProjectDatabase = projectDatabase;
     }
 
+    /**
+     * @brief ProjectTranslator::session
+     * @return
+     */
+    SharedTranslationSession ProjectTranslator::session() const
+    {
+        return m_Session;
+    }
+
+    /**
+     * @brief ProjectTranslator::setSession
+     * @param session
+     */
+    void ProjectTranslator::setSession(const SharedTranslationSession &session)
+    {
+        m_Session = session;
+    }
+
     Code ProjectTranslator::translate(const Common::SharedBasicEntity &e,
                                       const TranslatorOptions &options,
                                       const DB::SharedDatabase &localeDatabase,
@@ -847,8 +961,7 @@ namespace Translation {
     {
         QStringList scopesNames;
         auto id = type->scopeId();
-        Entity::SharedScope scope = Util::findScope(id, localeDatabase, classDatabase,
-                                                       m_ProjectDatabase, m_GlobalDatabase);
+        Entity::SharedScope scope = findScope(id, localeDatabase, classDatabase);
         do {
             if (!scope || id == Common::ID::globalScopeID() ||
                 id == Common::ID::localTemplateScopeID())
@@ -858,8 +971,7 @@ namespace Translation {
                 scopesNames.prepend(scope->name());
 
             id = scope->scopeId();
-            scope = Util::findScope(id, localeDatabase, classDatabase,
-                                       m_ProjectDatabase, m_GlobalDatabase);
+            scope = findScope(id, localeDatabase, classDatabase);
         } while (true);
 
         if (!scopesNames.isEmpty() && (options & WithNamespace)) {
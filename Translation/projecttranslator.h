@@ -31,9 +31,12 @@
 #include <Entity/EntityTypes.hpp>
 #include <Common/CommonTypes.hpp>
 
+#include "translator_types.hpp"
+
 namespace Translation {
 
     struct Code;
+    class CodeBuilder;
 
     /**
      * @brief The ProjectTranslator class
@@ -51,12 +54,15 @@ namespace Translation {
             GenerateNumbers = 0x04,
             NoLhs           = 0x08,
             NoDefaultName   = 0x10,
+            NoAffixes       = 0x20,
         };
         Q_DECLARE_FLAGS(TranslatorOptions, TranslatorOption)
 
         ProjectTranslator();
         ProjectTranslator(const DB::SharedDatabase &globalDb,
                           const DB::SharedProjectDatabase &projectDb);
+        ProjectTranslator(const ProjectTranslator &src);
+        ProjectTranslator &operator =(const ProjectTranslator &rhs);
 
         DB::SharedDatabase globalDatabase() const;
         void setGlobalDatabase(const DB::SharedDatabase &globalDatabase);
@@ -64,6 +70,9 @@ namespace Translation {
         DB::SharedProjectDatabase projectDatabase() const;
         void setProjectDatabase(const DB::SharedProjectDatabase &projectDatabase);
 
+        SharedTranslationSession session() const;
+        void setSession(const SharedTranslationSession &session);
+
         Code translate(const Common::SharedBasicEntity &e,
                        const TranslatorOptions &options = WithNamespace,
                        const DB::SharedDatabase &localeDatabase = nullptr,
@@ -73,7 +82,7 @@ namespace Translation {
                                       const DB::SharedDatabase &localeDatabase = nullptr) const;
         Code generateClassMethodsImpl(const Entity::SharedTemplateClass &_class) const;
 
-        void addNamespace(const Entity::SharedType &type, Code &code, uint indentCount = 1);
+        void addNamespace(const Entity::SharedType &type, Code &code, uint indentCount = 1) const;
 
     private: // Translators
         Code translateType(const Entity::SharedType &type,
@@ -106,19 +115,28 @@ namespace Translation {
                             const DB::SharedDatabase &classDatabase = nullptr) const;
 
     private:
+        enum class LookupOrder { ProjectFirst, GlobalFirst };
+
         void checkDb() const;
         void makeCallbacks();
+        Entity::SharedType findType(const Common::ID &id,
+                                    const DB::SharedDatabase &localeDatabase = nullptr,
+                                    const DB::SharedDatabase &classDatabase = nullptr,
+                                    LookupOrder order = LookupOrder::ProjectFirst) const;
+        Entity::SharedScope findScope(const Common::ID &id,
+                                      const DB::SharedDatabase &localeDatabase = nullptr,
+                                      const DB::SharedDatabase &classDatabase = nullptr) const;
         QString generateCodeForExtTypeOrType(const Common::ID &id, const TranslatorOptions &options,
                                              const DB::SharedDatabase &localeDatabase = nullptr,
                                              const DB::SharedDatabase &classDatabase = nullptr) const;
         void generateClassSection(const Entity::SharedClass &_class,
                                   const DB::SharedDatabase &localeDatabase,
-                                  Entity::Section section, QString &out) const;
+                                  Entity::Section section, CodeBuilder &out) const;
         void generateMethods(const Entity::MethodsList &methods, const DB::SharedDatabase &localeDatabase,
-                             const QString &indent, QString &out) const;
+                             const QString &indent, CodeBuilder &out) const;
         void generateFileds(const Entity::FieldsList &fields, const Entity::SharedClass &_class,
                             const DB::SharedDatabase &localeDatabase, const QString &indent,
-                            QString &out) const;
+                            CodeBuilder &out) const;
         void generateTemplatePart(QString &result, const Entity::SharedTemplate &t,
                                   bool withDefaultTypes = true) const;
         bool toHeader(const Entity::SharedMethod &m,
@@ -126,10 +144,11 @@ namespace Translation {
         void generateSectionMethods(const Entity::MethodsList &methods,
                                     const DB::SharedDatabase &localeDatabase,
                                     bool needSection, Entity::Section section,
-                                    const QString &marker, QString &out) const;
+                                    const QString &marker, CodeBuilder &out) const;
 
         DB::SharedDatabase m_GlobalDatabase;
         DB::SharedProjectDatabase m_ProjectDatabase;
+        SharedTranslationSession m_Session;
 
         using TranslatorsMap = QHash<size_t, std::function<Code(const Common::SharedBasicEntity &,
                                                                 const ProjectTranslator::TranslatorOptions &,
@@ -157,6 +157,24 @@ namespace Translation {
         return m_Scope;
     }
 
+    /**
+     * @brief SignatureMaker::globalDatabase
+     * @return
+     */
+    DB::SharedDatabase SignatureMaker::globalDatabase() const
+    {
+        return m_GlobalDatabase;
+    }
+
+    /**
+     * @brief SignatureMaker::projectDatabase
+     * @return
+     */
+    DB::SharedProjectDatabase SignatureMaker::projectDatabase() const
+    {
+        return m_ProjectDatabase;
+    }
+
     /**
      * @brief SignatureMaker::setScope
      * @param scope
@@ -59,6 +59,9 @@ namespace Translation {
         Entity::SharedScope scope() const;
         void setScope(const Entity::SharedScope &scope);
 
+        DB::SharedDatabase globalDatabase() const;
+        DB::SharedProjectDatabase projectDatabase() const;
+
     private:
         QString makeType(const Entity::SharedType &type) const;
         QString makeExtType(const Entity::SharedExtendedType &type) const;
@@ -0,0 +1,144 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+
+#include "translationsession.h"
+
+namespace Translation {
+
+    /**
+     * @brief TranslationSession::TranslationSession
+     */
+    TranslationSession::TranslationSession()
+        : m_Hits(0)
+        , m_Misses(0)
+    {}
+
+    /**
+     * @brief TranslationSession::type
+     * @param id
+     * @param resolve
+     * @return
+     */
+    Entity::SharedType TranslationSession::type(const Common::ID &id, const TypeResolver &resolve)
+    {
+        return lookup(m_Types, id, resolve);
+    }
+
+    /**
+     * @brief TranslationSession::scope
+     * @param id
+     * @param resolve
+     * @return
+     */
+    Entity::SharedScope TranslationSession::scope(const Common::ID &id, const ScopeResolver &resolve)
+    {
+        return lookup(m_Scopes, id, resolve);
+    }
+
+    /**
+     * @brief TranslationSession::typeName
+     * @param id
+     * @param options
+     * @param render
+     * @return
+     */
+    QString TranslationSession::typeName(const Common::ID &id, int options, const StringRenderer &render)
+    {
+        return lookup(m_TypeNames, qMakePair(id, options), render);
+    }
+
+    /**
+     * @brief TranslationSession::invalidate
+     */
+    void TranslationSession::invalidate()
+    {
+        QWriteLocker locker(&m_Lock);
+        m_Types.clear();
+        m_Scopes.clear();
+        m_TypeNames.clear();
+    }
+
+    /**
+     * @brief TranslationSession::invalidate
+     * @param id
+     */
+    void TranslationSession::invalidate(const Common::ID &id)
+    {
+        QWriteLocker locker(&m_Lock);
+        m_Types.remove(id);
+        m_Scopes.remove(id);
+
+        // Names of other types may include the name of this one (extended types, scopes),
+        // so rendered names can't be dropped selectively
+        m_TypeNames.clear();
+    }
+
+    /**
+     * @brief TranslationSession::hits
+     * @return
+     */
+    quint64 TranslationSession::hits() const
+    {
+        return m_Hits;
+    }
+
+    /**
+     * @brief TranslationSession::misses
+     * @return
+     */
+    quint64 TranslationSession::misses() const
+    {
+        return m_Misses;
+    }
+
+    /**
+     * @brief TranslationSession::lookup
+     * @param cache
+     * @param key
+     * @param resolve
+     * @return
+     */
+    template <class Cache, class Key, class Resolver>
+    typename Cache::mapped_type TranslationSession::lookup(Cache &cache, const Key &key,
+                                                           const Resolver &resolve)
+    {
+        {
+            QReadLocker locker(&m_Lock);
+            auto it = cache.constFind(key);
+            if (it != cache.cend()) {
+                ++m_Hits;
+                return *it;
+            }
+        }
+
+        // Resolve without lock, resolvers may call back into the session
+        ++m_Misses;
+        auto value = resolve();
+
+        QWriteLocker locker(&m_Lock);
+        cache.insert(key, value);
+
+        return value;
+    }
+
+} // namespace translation
@@ -0,0 +1,78 @@
+/*****************************************************************************
+**
+** Copyright (C) 2026 Fanaskov Vitaly (vt4a2h@gmail.com)
+**
+** Created 17/10/2026.
+**
+** This file is part of Q-UML (UML tool for Qt).
+**
+** Q-UML is free software: you can redistribute it and/or modify
+** it under the terms of the GNU Lesser General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Q-UML is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU Lesser General Public License for more details.
+
+** You should have received a copy of the GNU Lesser General Public License
+** along with Q-UML.  If not, see <http://www.gnu.org/licenses/>.
+**
+*****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include <QHash>
+#include <QPair>
+#include <QReadWriteLock>
+
+#include <Common/ID.h>
+#include <Entity/EntityTypes.hpp>
+
+namespace Translation {
+
+    /**
+     * @brief The TranslationSession class. Memoises lookups made by the translator
+     * during one generation run: type and scope by ID and rendered type names.
+     * Databases must not be changed while the session is alive, otherwise call invalidate().
+     * Safe for concurrent use.
+     */
+    class TranslationSession
+    {
+    public:
+        using TypeResolver   = std::function<Entity::SharedType()>;
+        using ScopeResolver  = std::function<Entity::SharedScope()>;
+        using StringRenderer = std::function<QString()>;
+
+        TranslationSession();
+
+        Entity::SharedType type(const Common::ID &id, const TypeResolver &resolve);
+        Entity::SharedScope scope(const Common::ID &id, const ScopeResolver &resolve);
+        QString typeName(const Common::ID &id, int options, const StringRenderer &render);
+
+        void invalidate();
+        void invalidate(const Common::ID &id);
+
+        quint64 hits() const;
+        quint64 misses() const;
+
+    private:
+        template <class Cache, class Key, class Resolver>
+        typename Cache::mapped_type lookup(Cache &cache, const Key &key, const Resolver &resolve);
+
+        using TypeNameKey = QPair<Common::ID, int>;
+
+        mutable QReadWriteLock m_Lock;
+        QHash<Common::ID, Entity::SharedType> m_Types;
+        QHash<Common::ID, Entity::SharedScope> m_Scopes;
+        QHash<TypeNameKey, QString> m_TypeNames;
+
+        std::atomic<quint64> m_Hits;
+        std::atomic<quint64> m_Misses;
+    };
+
+} // namespace translation
@@ -31,4 +31,7 @@ namespace Translation {
 
     class SignatureMaker;
     using UniqueSignatureMaker = std::unique_ptr<SignatureMaker>;
+
+    class TranslationSession;
+    using SharedTranslationSession = std::shared_ptr<TranslationSession>;
 }
@@ -232,7 +232,7 @@ namespace Util {
 
         while (scope && id != Common::ID::globalScopeID()) {
             result << scope->name();
-            id = scope->scopeId();
+            id = db->parentScopeID(scope->id());
             scope = db->scope(id, true /*searchInDepth*/);
         }
 
@@ -2,7 +2,7 @@ TEMPLATE = app
 
 CONFIG += core gui c++1z
 
-QT += widgets
+QT += widgets concurrent
 
 QMAKE_CXXFLAGS *= -pedantic -Wextra -Wall
 
@@ -15,9 +15,13 @@ SOURCES += \
     Commands/CommandFactory.cpp \
     Commands/CreateEntity.cpp \
     Commands/CreateScope.cpp \
+    Commands/EditComponent.cpp \
+    Commands/ImportDeclarations.cpp \
     Commands/MakeProjectCurrent.cpp \
     Commands/MementoCmd.cpp \
     Commands/MoveGraphicObject.cpp \
+    Commands/ResizeGraphicEntity.cpp \
+    Commands/UndoMemoryLimiter.cpp \
     Commands/OpenProject.cpp \
     Commands/RemoveComponentsCommands.cpp \
     Commands/RemoveProject.cpp \
@@ -27,11 +31,16 @@ SOURCES += \
     Common/ID.cpp \
     Common/IOriginator.cpp \
     Common/Memento.cpp \
+    Common/MementoDelta.cpp \
+    Common/StringPool.cpp \
+    DB/BinaryFormat.cpp \
     DB/Database.cpp \
+    DB/LazyLoader.cpp \
     DB/ProjectDatabase.cpp \
     Entity/Class.cpp \
     Entity/ClassMethod.cpp \
     Entity/Components/componentsignatureparser.cpp \
+    Entity/Components/declarationsimporter.cpp \
     Entity/Components/icomponents.cpp \
     Entity/Components/token.cpp \
     Entity/Converters/BaseTextConversionStrategy.cpp \
@@ -67,8 +76,10 @@ SOURCES += \
     GUI/graphics/GraphicsRelation.cpp \
     GUI/graphics/HeaderEditorEventFilter.cpp \
     GUI/graphics/Scene.cpp \
+    GUI/graphics/SpatialGrid.cpp \
     Generator/abstractprojectgenerator.cpp \
     Generator/basiccppprojectgenerator.cpp \
+    Generator/generationmanifest.cpp \
     Generator/virtualdirectory.cpp \
     Generator/virtualfile.cpp \
     Generator/virtualfilesystemabstractitem.cpp \
@@ -81,6 +92,7 @@ SOURCES += \
     Models/ProjectTreeModel.cpp \
     Project/Project.cpp \
     Project/ProjectFactory.cpp \
+    Project/ProjectJournal.cpp \
     Relationship/Relation.cpp \
     Relationship/RelationFactory.cpp \
     Relationship/association.cpp \
@@ -90,8 +102,10 @@ SOURCES += \
     Relationship/node.cpp \
     Relationship/realization.cpp \
     Translation/code.cpp \
+    Translation/codebuilder.cpp \
     Translation/projecttranslator.cpp \
     Translation/signaturemaker.cpp \
+    Translation/translationsession.cpp \
     Utility/helpfunctions.cpp \
     main.cpp \
     templates.cpp \
@@ -107,9 +121,13 @@ HEADERS += \
     Commands/CommandsTypes.h \
     Commands/CreateEntity.h \
     Commands/CreateScope.h \
+    Commands/EditComponent.h \
+    Commands/ImportDeclarations.h \
     Commands/MakeProjectCurrent.h \
     Commands/MementoCmd.hpp \
     Commands/MoveGraphicObject.h \
+    Commands/ResizeGraphicEntity.h \
+    Commands/UndoMemoryLimiter.h \
     Commands/OpenProject.h \
     Commands/RemoveComponentsCommands.h \
     Commands/RemoveProject.h \
@@ -120,19 +138,24 @@ HEADERS += \
     Common/ID.h \
     Common/IOriginator.hpp \
     Common/Memento.hpp \
+    Common/MementoDelta.hpp \
     Common/SharedFromThis.h \
+    Common/StringPool.h \
     Common/meta.h \
     Constants.h \
+    DB/BinaryFormat.h \
     DB/DBTypes.hpp \
     DB/Database.h \
     DB/IScopeSearcher.h \
     DB/ITypeSearcher.h \
+    DB/LazyLoader.h \
     DB/ProjectDatabase.h \
     Entity/Class.h \
     Entity/ClassMethod.h \
     Entity/Components/components_types.h \
     Entity/Components/componentscommon.h \
     Entity/Components/componentsignatureparser.h \
+    Entity/Components/declarationsimporter.h \
     Entity/Components/icomponents.h \
     Entity/Components/token.h \
     Entity/Converters/BaseTextConversionStrategy.hpp \
@@ -176,8 +199,10 @@ HEADERS += \
     GUI/graphics/GraphicsTypes.h \
     GUI/graphics/HeaderEditorEventFilter.h \
     GUI/graphics/Scene.h \
+    GUI/graphics/SpatialGrid.h \
     Generator/abstractprojectgenerator.h \
     Generator/basiccppprojectgenerator.h \
+    Generator/generationmanifest.h \
     Generator/generator_types.hpp \
     Generator/virtualdirectory.h \
     Generator/virtualfile.h \
@@ -194,6 +219,7 @@ HEADERS += \
     Project/Project.h \
     Project/ProjectTypes.hpp \
     Project/ProjectFactory.hpp \
+    Project/ProjectJournal.h \
     QtHelpers.h \
     Relationship/Relation.h \
     Relationship/RelationFactory.h \
@@ -205,9 +231,11 @@ HEADERS += \
     Relationship/realization.h \
     Relationship/relationship_types.hpp \
     Translation/code.h \
+    Translation/codebuilder.h \
     Translation/projecttranslator.h \
     Translation/signaturemaker.h \
     Translation/translator_types.hpp \
+    Translation/translationsession.h \
     Utility/helpfunctions.h \
     enums.h \
     types.h \